@@ -0,0 +1,67 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bench/harness.hpp>      // distributions, family, for_each_type, nanoseconds_per_value, print_header, print_row, random_values, type_name
+#include <xstd/charconv/to_chars.hpp>  // to_chars, to_chars_max_size
+#include <xstd/contracts.hpp>          // XSTD_CHECK_LEVEL
+#include <xstd/cstdlib/div.hpp>        // div
+#include <xstd/cstdlib/div_euclid.hpp> // div_euclid
+#include <xstd/cstdlib/div_floor.hpp>  // div_floor
+#include <array>                       // array
+#include <cstddef>                     // size_t
+#include <string>                      // to_string
+#include <string_view>                 // string_view
+
+#ifdef NDEBUG
+#error "built with NDEBUG, which turns every check level off: see bench/CMakeLists.txt"
+#endif
+
+namespace {
+
+// Every result summed and kept, so that no call is optimized away.
+std::size_t volatile sink = 0;
+
+template<class T, class F>
+auto time_calls(std::string_view function, xstd::bench::family f, F call)
+        -> void
+{
+        constexpr auto count = std::size_t{1} << 14U;
+        for (auto const d : xstd::bench::distributions) {
+                auto const values = xstd::bench::random_values<T>(d, count);
+                auto const ns = xstd::bench::nanoseconds_per_value(count, [&] {
+                        auto total = std::size_t{0};
+                        for (auto const value : values) {
+                                total += call(value);
+                        }
+                        sink = sink + total;
+                });
+                xstd::bench::print_row(function, f, xstd::bench::type_name<T>(), std::to_string(XSTD_CHECK_LEVEL), d, ns);
+        }
+}
+
+} // namespace
+
+// The same calls at whichever XSTD_CHECK_LEVEL this executable was built with: one per level, compared row by row.
+auto main() -> int
+{
+        xstd::bench::print_header();
+        xstd::bench::for_each_type([]<class T>(xstd::bench::family f) {
+                // NOLINTNEXTLINE(readability-magic-numbers): a denominator that is neither a power of two nor 1
+                auto const denom = T{7};
+                time_calls<T>("xstd::div", f, [=](T value) {
+                        return static_cast<std::size_t>(xstd::div(value, denom).remainder);
+                });
+                time_calls<T>("xstd::div_floor", f, [=](T value) {
+                        return static_cast<std::size_t>(xstd::div_floor(value, denom).remainder);
+                });
+                time_calls<T>("xstd::div_euclid", f, [=](T value) {
+                        return static_cast<std::size_t>(xstd::div_euclid(value, denom).remainder);
+                });
+                time_calls<T>("xstd::to_chars", f, [](T value) {
+                        auto buffer = std::array<char, xstd::to_chars_max_size<T>>{};
+                        return static_cast<std::size_t>(xstd::to_chars(buffer.data(), buffer.data() + buffer.size(), value).ptr - buffer.data());
+                });
+        });
+}
@@ -0,0 +1,169 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef XSTD_BENCH_HARNESS_HPP
+#define XSTD_BENCH_HARNESS_HPP
+
+#include <xstd/test/exact_width_types.hpp>    // std_signed_types, xstd_signed_types, boost_signed_types, absl_signed_types, bit_precise_signed_types, and unsigned
+#include <xstd/limits.hpp>                    // numeric_limits
+#include <xstd/type_traits/is_signed.hpp>     // is_signed_v
+#include <xstd/type_traits/make_unsigned.hpp> // make_unsigned_t
+#include <algorithm>                          // min
+#include <array>                              // array
+#include <chrono>                             // duration, steady_clock
+#include <cstddef>                            // size_t
+#include <cstdint>                            // uint64_t
+#include <cstdio>                             // printf
+#include <limits>                             // numeric_limits
+#include <string>                             // string, to_string
+#include <string_view>                        // string_view
+#include <tuple>                              // tuple
+#include <vector>                             // vector
+
+// A timing loop with no dependency beyond the standard library: a regression is a ratio, not a statistic.
+namespace xstd::bench {
+
+// xorshift64*, seeded the same on every run, so that two runs time the same values.
+class random_bits
+{
+        std::uint64_t state = 0x9e37'79b9'7f4a'7c15;
+
+public:
+        auto operator()() noexcept
+                -> std::uint64_t
+        {
+                state ^= state >> 12U;
+                state ^= state << 25U;
+                state ^= state >> 27U;
+                return state * 0x2545'f491'4f6c'dd1d;
+        }
+};
+
+// How the values of one run are drawn: their digit count is what the cost of writing them follows.
+enum class distribution
+{
+        small,   // below 100: the one- and two-digit values most columns hold
+        uniform, // every bit random: nearly all of them the full length
+        length   // a random bit length first: every digit count about as often
+};
+
+inline constexpr auto distributions = std::array{distribution::small, distribution::uniform, distribution::length};
+
+[[nodiscard]] constexpr auto name(distribution d) noexcept
+        -> std::string_view
+{
+        switch (d) {
+        case distribution::small: return "small";
+        case distribution::uniform: return "uniform";
+        default: return "length";
+        }
+}
+
+// count values of T, the unsigned bits reinterpreted modularly when T is signed, so half are negative.
+template<class T>
+[[nodiscard]] auto random_values(distribution d, std::size_t count)
+        -> std::vector<T>
+{
+        using U = make_unsigned_t<T>;
+        constexpr auto digits = numeric_limits<U>::digits;
+        constexpr auto word = std::numeric_limits<std::uint64_t>::digits;
+        auto bits = random_bits{};
+        auto values = std::vector<T>{};
+        values.reserve(count);
+        while (values.size() != count) {
+                auto u = U{0};
+                for (auto filled = 0; filled < digits; filled += word) {
+                        if constexpr (digits > word) {
+                                u = static_cast<U>(u << static_cast<std::size_t>(word));
+                        }
+                        u = static_cast<U>(u | static_cast<U>(bits()));
+                }
+                switch (d) {
+                case distribution::small:
+                        // NOLINTNEXTLINE(readability-magic-numbers): two digits
+                        u = static_cast<U>(bits() % 100);
+                        break;
+                case distribution::uniform:
+                        break;
+                default:
+                        u = static_cast<U>(u >> static_cast<std::size_t>(bits() % static_cast<std::uint64_t>(digits)));
+                }
+                values.push_back(static_cast<T>(u));
+        }
+        return values;
+}
+
+// The best of several runs of f over all values, per value: the minimum is the least noisy estimate.
+template<class F>
+[[nodiscard]] auto nanoseconds_per_value(std::size_t count, F f)
+        -> double
+{
+        constexpr auto repetitions = 7;
+        auto best = std::numeric_limits<double>::infinity();
+        for (auto i = 0; i != repetitions; ++i) {
+                auto const start = std::chrono::steady_clock::now();
+                f();
+                auto const stop = std::chrono::steady_clock::now();
+                best = std::min(best, std::chrono::duration<double, std::nano>(stop - start).count());
+        }
+        return best / static_cast<double>(count);
+}
+
+// The families of exact_width_types.hpp, each named, so a row says which implementation it timed.
+struct family
+{
+        std::string_view name;
+};
+
+// "int128", "uint64" and so on, from the width rather than a spelling that differs per family.
+template<class T>
+[[nodiscard]] auto type_name()
+        -> std::string
+{
+        return (is_signed_v<T> ? "int" : "uint") + std::to_string(numeric_limits<T>::digits + (is_signed_v<T> ? 1 : 0));
+}
+
+// Calls f.template operator()<T>(family) for every type of every family, signed and unsigned.
+template<class F>
+auto for_each_type(F f)
+        -> void
+{
+        auto const visit = [&]<class... Ts>(std::string_view name, std::tuple<Ts...>*) {
+                (f.template operator()<Ts>(family{name}), ...);
+        };
+        visit("std", static_cast<test::std_signed_types*>(nullptr));
+        visit("std", static_cast<test::std_unsigned_types*>(nullptr));
+        visit("xstd", static_cast<test::xstd_signed_types*>(nullptr));
+        visit("xstd", static_cast<test::xstd_unsigned_types*>(nullptr));
+        visit("boost", static_cast<test::boost_signed_types*>(nullptr));
+        visit("boost", static_cast<test::boost_unsigned_types*>(nullptr));
+        visit("absl", static_cast<test::absl_signed_types*>(nullptr));
+        visit("absl", static_cast<test::absl_unsigned_types*>(nullptr));
+        visit("bit_precise", static_cast<test::bit_precise_signed_types*>(nullptr));
+        visit("bit_precise", static_cast<test::bit_precise_unsigned_types*>(nullptr));
+}
+
+// One CSV row per measurement, under one header: what a script diffs between two builds.
+// The parameter is whatever else a function is timed over: a conversion's base, a division's denominator.
+inline auto print_header()
+        -> void
+{
+        std::printf("function,family,type,parameter,distribution,ns_per_value\n");
+}
+
+inline auto print_row(std::string_view function, family f, std::string const& type, std::string const& parameter, distribution d, double ns)
+        -> void
+{
+        std::printf("%.*s,%.*s,%s,%s,%.*s,%.3f\n",
+                    static_cast<int>(function.size()), function.data(),
+                    static_cast<int>(f.name.size()), f.name.data(),
+                    type.c_str(), parameter.c_str(),
+                    static_cast<int>(name(d).size()), name(d).data(),
+                    ns);
+}
+
+} // namespace xstd::bench
+
+#endif // XSTD_BENCH_HARNESS_HPP
@@ -0,0 +1,90 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bench/harness.hpp>           // distribution, distributions, family, for_each_type, nanoseconds_per_value, print_header, print_row, random_values, type_name
+#include <xstd/charconv/to_chars.hpp>       // to_chars, to_chars_max_size
+#include <xstd/charconv/to_chars_batch.hpp> // to_chars_batch
+#include <array>                            // array
+#include <charconv>                         // to_chars
+#include <cstddef>                          // size_t
+#include <span>                             // span
+#include <string_view>                      // string_view
+#include <vector>                           // vector
+
+namespace {
+
+// Every written length summed and kept, so that no call is optimized away.
+std::size_t volatile sink = 0;
+
+template<class T, class ToChars>
+auto time_to_chars(std::string_view function, xstd::bench::family f, int base, xstd::bench::distribution d, ToChars to_chars)
+        -> void
+{
+        constexpr auto count = std::size_t{1} << 14U;
+        auto const values = xstd::bench::random_values<T>(d, count);
+        auto buffer = std::array<char, xstd::to_chars_max_size<T>>{};
+        auto const ns = xstd::bench::nanoseconds_per_value(count, [&] {
+                auto total = std::size_t{0};
+                for (auto const value : values) {
+                        total += static_cast<std::size_t>(to_chars(buffer.data(), buffer.data() + buffer.size(), value, base).ptr - buffer.data());
+                }
+                sink = sink + total;
+        });
+        xstd::bench::print_row(function, f, xstd::bench::type_name<T>(), std::to_string(base), d, ns);
+}
+
+// A whole column into one delimited buffer, with the end of every value: the layout to_chars_batch writes.
+template<class T, class Batch>
+auto time_batch(std::string_view function, xstd::bench::family f, int base, xstd::bench::distribution d, Batch batch)
+        -> void
+{
+        constexpr auto count = std::size_t{1} << 14U;
+        auto const values = xstd::bench::random_values<T>(d, count);
+        auto buffer = std::vector<char>(count * (xstd::to_chars_max_size<T> + 1));
+        auto ends = std::vector<std::size_t>(count);
+        auto const ns = xstd::bench::nanoseconds_per_value(count, [&] {
+                auto const* const ptr = batch(std::span(values), buffer.data(), buffer.data() + buffer.size(), std::span(ends), base);
+                sink = sink + static_cast<std::size_t>(ptr - buffer.data());
+        });
+        xstd::bench::print_row(function, f, xstd::bench::type_name<T>(), std::to_string(base), d, ns);
+}
+
+} // namespace
+
+// xstd::to_chars and to_chars_batch for every type, and std::to_chars alongside wherever the standard library has it
+// for the type: one value at a time, and a column at a time.
+auto main() -> int
+{
+        xstd::bench::print_header();
+        xstd::bench::for_each_type([]<class T>(xstd::bench::family f) {
+                for (auto const base : {2, 10, 16}) {
+                        for (auto const d : xstd::bench::distributions) {
+                                time_to_chars<T>("xstd::to_chars", f, base, d, [](char* first, char* last, T value, int b) {
+                                        return xstd::to_chars(first, last, value, b);
+                                });
+                                time_batch<T>("xstd::to_chars_batch", f, base, d, [](std::span<T const> values, char* first, char* last, std::span<std::size_t> ends, int b) {
+                                        return xstd::to_chars_batch(values, first, last, ',', ends, b).ptr;
+                                });
+                                if constexpr (requires(char* p, T value) { std::to_chars(p, p, value, 10); }) {
+                                        time_to_chars<T>("std::to_chars", f, base, d, [](char* first, char* last, T value, int b) {
+                                                return std::to_chars(first, last, value, b);
+                                        });
+                                        // The same column one std::to_chars call at a time, each bounds-checked against the rest.
+                                        time_batch<T>("std::to_chars loop", f, base, d, [](std::span<T const> values, char* first, char* last, std::span<std::size_t> ends, int b) {
+                                                auto* out = first;
+                                                for (auto i = std::size_t{0}; i != values.size(); ++i) {
+                                                        if (i != 0) {
+                                                                *out++ = ',';
+                                                        }
+                                                        out = std::to_chars(out, last, values[i], b).ptr;
+                                                        ends[i] = static_cast<std::size_t>(out - first);
+                                                }
+                                                return out;
+                                        });
+                                }
+                        }
+                }
+        });
+}
@@ -0,0 +1,67 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bench/harness.hpp>      // distributions, family, nanoseconds_per_value, print_header, print_row, random_values, type_name
+#include <xstd/cstdint/int128.hpp>     // int128, uint128
+#include <xstd/cstdlib/div.hpp>        // div
+#include <xstd/cstdlib/div_floor.hpp>  // div_floor
+#include <xstd/cstdlib/div_result.hpp> // div_result
+#include <cstddef>                     // size_t
+#include <string>                      // string
+#include <string_view>                 // string_view
+
+namespace {
+
+// Every quotient and remainder summed and kept, so that no call is optimized away.
+unsigned long long volatile sink = 0;
+
+template<class T, class Div>
+auto time_div(std::string_view function, std::string const& workload, T denom, Div div)
+        -> void
+{
+        constexpr auto count = std::size_t{1} << 14U;
+        for (auto const d : xstd::bench::distributions) {
+                auto const values = xstd::bench::random_values<T>(d, count);
+                auto const ns = xstd::bench::nanoseconds_per_value(count, [&] {
+                        auto total = T{0};
+                        for (auto const value : values) {
+                                auto const [quotient, remainder] = div(value, denom);
+                                total = static_cast<T>(total + quotient + remainder);
+                        }
+                        sink = sink + static_cast<unsigned long long>(total);
+                });
+                xstd::bench::print_row(function, xstd::bench::family{"xstd"}, xstd::bench::type_name<T>(), workload, d, ns);
+        }
+}
+
+// The compiler's / and %, a library call for 128 bits, against xstd::div's 64-bit steps for a denominator that fits.
+template<class T>
+auto time_workload(std::string const& workload, T denom)
+        -> void
+{
+        time_div<T>("operator/", workload, denom, [](T n, T d) {
+                return xstd::div_result<T>{static_cast<T>(n / d), static_cast<T>(n % d)};
+        });
+        time_div<T>("xstd::div", workload, denom, [](T n, T d) {
+                return xstd::div(n, d);
+        });
+        time_div<T>("xstd::div_floor", workload, denom, [](T n, T d) {
+                return xstd::div_floor(n, d);
+        });
+}
+
+} // namespace
+
+// The two divisions the narrow path is for: to_chars' chunk of 19 decimal digits, and timestamps bucketed by a period.
+auto main() -> int
+{
+        xstd::bench::print_header();
+        // NOLINTBEGIN(readability-magic-numbers): 10^19, and a minute in nanoseconds
+        time_workload<xstd::uint128>("to_chars_chunk", xstd::uint128{10'000'000'000'000'000'000U});
+        time_workload<xstd::int128>("to_chars_chunk", xstd::int128{10'000'000'000'000'000'000U});
+        time_workload<xstd::uint128>("minute_bucket", xstd::uint128{60'000'000'000});
+        time_workload<xstd::int128>("minute_bucket", xstd::int128{60'000'000'000});
+        // NOLINTEND(readability-magic-numbers)
+}
@@ -0,0 +1,75 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef XSTD_BIT_HPP
+#define XSTD_BIT_HPP
+
+#include <xstd/concepts/nothrow_const_operators.hpp> // nothrow_const_operators
+#include <xstd/concepts/unsigned_integer.hpp>        // unsigned_integer
+#include <xstd/limits/numeric_limits.hpp>            // numeric_limits
+#include <bit>                                       // bit_width, countr_zero
+#include <cstddef>                                   // size_t
+
+namespace xstd {
+
+// std::bit_width, opened to every unsigned xstd integer; the width is an int, as after LWG 3656.
+template<unsigned_integer U>
+[[nodiscard]] constexpr auto bit_width(U x) noexcept(nothrow_const_operators<U>)
+        -> int
+{
+        // [iterator.concept.winc]/6 converts any integer-class type to std::size_t, keeping the low bits.
+        constexpr auto chunk_width = numeric_limits<std::size_t>::digits;
+        if constexpr (numeric_limits<U>::digits <= chunk_width) {
+                return static_cast<int>(std::bit_width(static_cast<std::size_t>(x)));
+        } else {
+                // An integer-class type has no countl_zero: the top set bit is searched for by halving the span it lies
+                // in, one shift per halving, until that span fits in a chunk. Logarithmic in the width, not linear.
+                auto width = 0;
+                for (auto span = numeric_limits<U>::digits; span > chunk_width;) {
+                        auto const half = span / 2;
+                        if (auto const high = static_cast<U>(x >> static_cast<std::size_t>(half)); high != U{0}) {
+                                x = high;
+                                width += half;
+                                span -= half;
+                        } else {
+                                span = half;
+                        }
+                }
+                return width + static_cast<int>(std::bit_width(static_cast<std::size_t>(x)));
+        }
+}
+
+// std::countr_zero, opened the same way: the exponent of the largest power of two dividing x, digits for zero.
+template<unsigned_integer U>
+[[nodiscard]] constexpr auto countr_zero(U x) noexcept(nothrow_const_operators<U>)
+        -> int
+{
+        constexpr auto chunk_width = numeric_limits<std::size_t>::digits;
+        if constexpr (numeric_limits<U>::digits <= chunk_width) {
+                return x == U{0} ? numeric_limits<U>::digits : static_cast<int>(std::countr_zero(static_cast<std::size_t>(x)));
+        } else {
+                if (x == U{0}) {
+                        return numeric_limits<U>::digits;
+                }
+                // The lowest set bit is searched for the same way: the low half of its span shifted out while all zeros.
+                constexpr auto digits = numeric_limits<U>::digits;
+                auto count = 0;
+                for (auto span = digits; span > chunk_width;) {
+                        auto const half = span / 2;
+                        if (static_cast<U>(x << static_cast<std::size_t>(digits - half)) == U{0}) {
+                                x = static_cast<U>(x >> static_cast<std::size_t>(half));
+                                count += half;
+                                span -= half;
+                        } else {
+                                span = half;
+                        }
+                }
+                return count + static_cast<int>(std::countr_zero(static_cast<std::size_t>(x)));
+        }
+}
+
+} // namespace xstd
+
+#endif // XSTD_BIT_HPP
@@ -7,6 +7,13 @@
 #define XSTD_CHARCONV_HPP
 
 // Primitive numeric output conversion
-#include <xstd/charconv/to_chars.hpp> // IWYU pragma: export; to_chars, to_chars_max_size
+#include <xstd/charconv/to_chars.hpp>        // IWYU pragma: export; basic_to_chars_result, to_chars, to_chars_max_size, to_chars_size
+#include <xstd/charconv/to_chars_batch.hpp>  // IWYU pragma: export; to_chars_batch
+#include <xstd/charconv/to_chars_padded.hpp> // IWYU pragma: export; to_chars_grouped, to_chars_padded
+#include <xstd/charconv/to_fixed_chars.hpp>  // IWYU pragma: export; fixed_chars, to_fixed_chars
+
+// Primitive numeric input conversion
+#include <xstd/charconv/from_chars.hpp>   // IWYU pragma: export; from_chars
+#include <xstd/charconv/parse_digits.hpp> // IWYU pragma: export; parse_digits8, parse_hex_digits8
 
 #endif // XSTD_CHARCONV_HPP
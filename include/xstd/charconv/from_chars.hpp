@@ -0,0 +1,310 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef XSTD_CHARCONV_FROM_CHARS_HPP
+#define XSTD_CHARCONV_FROM_CHARS_HPP
+
+#include <xstd/bit.hpp>                       // bit_width
+#include <xstd/charconv/parse_digits.hpp>     // parse_digits8, parse_hex_digits8
+#include <xstd/charconv/to_chars.hpp>         // detail::chunk_radices, detail::chunk_type, detail::decimal_radix, detail::delegates_to_std, detail::digit_chars, detail::digit_count, detail::make_split_powers, detail::max_split_chunks, detail::split_powers, detail::split_threshold, detail::split_type_t, detail::splits
+#include <xstd/concepts/integer.hpp>          // integer
+#include <xstd/contracts.hpp>                 // XSTD_PRECONDITION
+#include <xstd/limits/numeric_limits.hpp>     // numeric_limits
+#include <xstd/type_traits/is_signed.hpp>     // is_signed_v
+#include <xstd/type_traits/make_unsigned.hpp> // make_unsigned_t
+#include <array>                              // array
+#include <bit>                                // countr_zero
+#include <charconv>                           // from_chars, from_chars_result
+#include <concepts>                           // integral
+#include <cstddef>                            // size_t
+#include <iterator>                           // distance
+#include <system_error>                       // errc
+#include <type_traits>                        // conditional_t
+
+namespace xstd {
+
+namespace detail {
+
+// The standard takes char and the integer types by reference, so a wider character type has no overload to reach.
+template<class I>
+concept delegates_from_chars_to_std =
+        delegates_to_std<I> and requires (char const* p, I& value, int base) { std::from_chars(p, p, value, base); };
+
+// strtol reads a letter digit in either case, and [charconv.from.chars] matches strtol.
+inline constexpr auto const* upper_digit_chars = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+// Every character's value as a digit, and 36 for one that is none: a single compare against the base rejects it.
+inline constexpr auto digit_values = []() {
+        auto const not_a_digit = static_cast<unsigned char>(36);
+        auto values = std::array<unsigned char, static_cast<std::size_t>(numeric_limits<unsigned char>::max()) + 1>{};
+        values.fill(not_a_digit);
+        for (auto digit = std::size_t{0}; digit != not_a_digit; ++digit) {
+                values[static_cast<unsigned char>(digit_chars[digit])] = static_cast<unsigned char>(digit);
+                values[static_cast<unsigned char>(upper_digit_chars[digit])] = static_cast<unsigned char>(digit);
+        }
+        return values;
+}();
+
+// Up to count digits as one chunk, the power of the radix they span, and where they stop.
+struct parsed_chunk
+{
+        char const* ptr;
+        chunk_type value;
+        chunk_type scale;
+};
+
+// In native arithmetic throughout: count never exceeds what a chunk holds in this radix, nor does the scale.
+constexpr auto from_chars_chunk(char const* first, char const* last, chunk_type radix, int count) noexcept
+        -> parsed_chunk
+{
+        auto chunk = parsed_chunk{.ptr = first, .value = 0, .scale = 1};
+
+        // Eight digits per load where there is a kernel for the base, and a chunk is wide enough to take them.
+        constexpr auto hex_radix = chunk_type{16};
+        if constexpr (numeric_limits<chunk_type>::digits >= 64) {
+                if (radix == decimal_radix) {
+                        for (; count >= 8 and std::distance(chunk.ptr, last) >= 8; count -= 8, chunk.ptr += 8) {
+                                auto const digits = parse_digits8(chunk.ptr);
+                                if (not digits) {
+                                        break;
+                                }
+                                chunk.value = chunk.value * 100'000'000 + *digits;
+                                chunk.scale *= 100'000'000;
+                        }
+                } else if (radix == hex_radix) {
+                        for (; count >= 8 and std::distance(chunk.ptr, last) >= 8; count -= 8, chunk.ptr += 8) {
+                                auto const digits = parse_hex_digits8(chunk.ptr);
+                                if (not digits) {
+                                        break;
+                                }
+                                chunk.value = (chunk.value << 32U) | *digits;
+                                chunk.scale <<= 32U;
+                        }
+                }
+        }
+
+        // The rest one at a time, up to the first that is no digit in this base.
+        for (; count != 0 and chunk.ptr != last; --count, ++chunk.ptr) {
+                auto const digit = chunk_type{digit_values[static_cast<unsigned char>(*chunk.ptr)]};
+                if (digit >= radix) {
+                        break;
+                }
+                chunk.value = chunk.value * radix + digit;
+                chunk.scale *= radix;
+        }
+        return chunk;
+}
+
+// magnitude * scale + chunk, unless that exceeds limit: decided by bit widths, and never by a wide division.
+template<class A>
+[[nodiscard]] constexpr auto fold_within(A& magnitude, chunk_type scale, chunk_type chunk, A limit)
+        -> bool
+{
+        // Two more bits than A has is past any limit; up to as many fit; one more fits once the scale is halved.
+        constexpr auto width = numeric_limits<A>::digits;
+        auto const product_width = bit_width(magnitude) + bit_width(scale);
+        if (product_width > width + 1) {
+                return false;
+        }
+        auto const one = static_cast<std::size_t>(1);
+        auto const halved = product_width > width;
+        auto const product = static_cast<A>(magnitude * static_cast<A>(halved ? scale >> one : scale));
+        auto room = limit;
+        if (halved) {
+                // Doubled back only below half the limit, with the odd scale's last magnitude added on its own.
+                if (product > (limit >> one)) {
+                        return false;
+                }
+                room = static_cast<A>(room - static_cast<A>(product << one));
+                if (scale % 2 != 0) {
+                        if (magnitude > room) {
+                                return false;
+                        }
+                        room = static_cast<A>(room - magnitude);
+                }
+        } else {
+                if (product > room) {
+                        return false;
+                }
+                room = static_cast<A>(room - product);
+        }
+        if (static_cast<A>(chunk) > room) {
+                return false;
+        }
+        magnitude = static_cast<A>(limit - room + static_cast<A>(chunk));
+        return true;
+}
+
+// The significant digits of a magnitude, where they stop, and whether they exceed its limit.
+template<class A>
+struct parsed_magnitude
+{
+        char const* ptr;
+        A value;
+        bool out_of_range;
+};
+
+// count digits, all known to be digits and at most Chunks chunks of them, in the narrowest type that holds that many.
+template<class A, std::size_t Chunks>
+[[nodiscard]] constexpr auto from_chars_split(char const* first, int count, chunk_type radix, split_powers<A> const& powers)
+        -> split_type_t<A, Chunks>
+{
+        using T = split_type_t<A, Chunks>;
+        auto const exponent = chunk_radices[radix].exponent;
+        if constexpr (Chunks <= split_threshold) {
+                // Few enough chunks to fold one at a time: the first takes the odd digits, so the rest are whole.
+                auto value = T{0};
+                for (auto chunk_count = (count - 1) % exponent + 1; count != 0; count -= chunk_count, chunk_count = exponent) {
+                        auto const [ptr, chunk, scale] = from_chars_chunk(first, first + chunk_count, radix, chunk_count);
+                        value = static_cast<T>(value * static_cast<T>(scale) + static_cast<T>(chunk));
+                        first = ptr;
+                }
+                return value;
+        } else {
+                // Halved by the power of the chunk radix a half spans, each half in a type half as wide.
+                constexpr auto half = Chunks / 2;
+                auto const low_count = exponent * static_cast<int>(half);
+                if (count <= low_count) {
+                        return static_cast<T>(from_chars_split<A, half>(first, count, radix, powers));
+                }
+                auto const high = from_chars_split<A, half>(first, count - low_count, radix, powers);
+                auto const low = from_chars_split<A, half>(first + (count - low_count), low_count, radix, powers);
+                auto const& power = powers.powers[static_cast<std::size_t>(std::countr_zero(half))];
+                return static_cast<T>(static_cast<T>(high) * static_cast<T>(power) + static_cast<T>(low));
+        }
+}
+
+// The significant digits from first, folded into A up to limit: by chunks, or for a wide type, divide-and-conquer.
+template<class A>
+[[nodiscard]] constexpr auto from_chars_magnitude(char const* first, char const* last, chunk_type radix, A limit)
+        -> parsed_magnitude<A>
+{
+        // Shorter than the limit, a value cannot exceed it; as long, it can; longer, it does.
+        auto const limit_count = digit_count(limit, radix);
+        auto const exponent = chunk_radices[radix].exponent;
+
+        if constexpr (splits<A>) {
+                // Far wider, a fold per chunk is quadratic: the digits are counted first, then split in halves.
+                auto digits_last = first;
+                while (digits_last != last and digit_values[static_cast<unsigned char>(*digits_last)] < radix) {
+                        ++digits_last;
+                }
+                auto const count = static_cast<int>(std::distance(first, digits_last));
+                if (count > limit_count) {
+                        return {.ptr = digits_last, .value = A{0}, .out_of_range = true};
+                }
+                if (count > split_threshold * exponent) {
+                        // The top split here, in A itself, where the limit can be passed; below it, nothing can.
+                        auto const powers = make_split_powers<A>(radix, count);
+                        auto const level = powers.levels - 1;
+                        auto const low_count = exponent << level;
+                        auto const high = static_cast<A>(from_chars_split<A, max_split_chunks<A> / 2>(first, count - low_count, radix, powers));
+                        auto const low = static_cast<A>(from_chars_split<A, max_split_chunks<A> / 2>(first + (count - low_count), low_count, radix, powers));
+                        auto const& power = powers.powers[static_cast<std::size_t>(level)];
+                        if (count == limit_count and high > (limit - low) / power) {
+                                return {.ptr = digits_last, .value = A{0}, .out_of_range = true};
+                        }
+                        return {.ptr = digits_last, .value = static_cast<A>(high * power + low), .out_of_range = false};
+                }
+        }
+
+        // A chunk of digits at a time, 19 in decimal, folded into the wide value by one multiply-add.
+        auto magnitude = static_cast<A>(0);
+        auto count = 0;
+        auto out_of_range = false;
+        for (;;) {
+                auto const [ptr, chunk, scale] = from_chars_chunk(first, last, radix, exponent);
+                auto const chunk_count = static_cast<int>(std::distance(first, ptr));
+                first = ptr;
+                if (not out_of_range and chunk_count != 0) {
+                        count += chunk_count;
+                        if (count < limit_count) {
+                                magnitude = static_cast<A>(magnitude * static_cast<A>(scale) + static_cast<A>(chunk));
+                        } else if (count == limit_count) {
+                                out_of_range = not fold_within(magnitude, scale, chunk, limit);
+                        } else {
+                                out_of_range = true;
+                        }
+                }
+                if (chunk_count != exponent) {
+                        break;
+                }
+        }
+        return {.ptr = first, .value = magnitude, .out_of_range = out_of_range};
+}
+
+} // namespace detail
+
+// The standard's own domain, which it declares for char and the integer types only.
+template<std::integral I>
+        requires detail::delegates_from_chars_to_std<I>
+// NOLINTNEXTLINE(readability-magic-numbers): the standard's own default base, see to_chars
+[[nodiscard]] constexpr auto from_chars(char const* first, char const* last, I& value, int base = 10)
+        -> std::from_chars_result
+{
+        XSTD_PRECONDITION(2 <= base and base <= 36);
+        return std::from_chars(first, last, value, base);
+}
+
+// For xstd integers the standard library does not cover.
+template<integer I>
+        requires (not detail::delegates_from_chars_to_std<I>)
+// NOLINTNEXTLINE(readability-magic-numbers): the standard's own default base, see to_chars
+[[nodiscard]] constexpr auto from_chars(char const* first, char const* last, I& value, int base = 10)
+        -> std::from_chars_result
+{
+        XSTD_PRECONDITION(2 <= base and base <= 36);
+
+        // The unsigned counterpart holds |min()|, so the digits accumulate unsigned, as to_chars takes them.
+        using U = make_unsigned_t<I>;
+        using detail::chunk_type;
+
+        // A minus sign only, and only for a signed type: no plus, no prefix, no whitespace.
+        auto next = first;
+        auto negative = false;
+        if constexpr (is_signed_v<I>) {
+                if (next != last and *next == '-') {
+                        negative = true;
+                        ++next;
+                }
+        }
+
+        // A type narrower than a chunk accumulates in the chunk's own type, so the limit check cannot wrap.
+        using A = std::conditional_t<(numeric_limits<U>::digits < numeric_limits<chunk_type>::digits), chunk_type, U>;
+        auto const max = static_cast<U>(numeric_limits<I>::max());
+        auto const limit = static_cast<A>(negative ? static_cast<U>(max + static_cast<U>(1)) : max);
+
+        // Leading zeros are digits but not significant ones: only the rest count towards the limit's length.
+        auto const digits_first = next;
+        while (next != last and *next == '0') {
+                ++next;
+        }
+
+        auto const [ptr, magnitude, out_of_range] = detail::from_chars_magnitude(next, last, static_cast<chunk_type>(base), limit);
+        next = ptr;
+
+        // As in the standard: no digits leave ptr at first, and neither failure touches value.
+        if (next == digits_first) {
+                return {.ptr = first, .ec = std::errc::invalid_argument};
+        }
+        if (out_of_range) {
+                return {.ptr = next, .ec = std::errc::result_out_of_range};
+        }
+
+        auto const u = static_cast<U>(magnitude);
+        if constexpr (is_signed_v<I>) {
+                // Negated one short of the magnitude, which I holds even when the magnitude is |min()|.
+                if (negative and u != static_cast<U>(0)) {
+                        value = static_cast<I>(-static_cast<I>(u - static_cast<U>(1)) - static_cast<I>(1));
+                        return {.ptr = next, .ec = std::errc{}};
+                }
+        }
+        value = static_cast<I>(u);
+        return {.ptr = next, .ec = std::errc{}};
+}
+
+} // namespace xstd
+
+#endif // XSTD_CHARCONV_FROM_CHARS_HPP
@@ -0,0 +1,93 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef XSTD_CHARCONV_PARSE_DIGITS_HPP
+#define XSTD_CHARCONV_PARSE_DIGITS_HPP
+
+#include <bit>      // byteswap, endian
+#include <cstdint>  // uint32_t, uint64_t
+#include <cstring>  // memcpy
+#include <optional> // nullopt, optional
+
+namespace xstd {
+
+namespace detail {
+
+// A byte in every lane: multiplied by it, any byte constant is broadcast across a word.
+inline constexpr auto lanes = std::uint64_t{0x0101'0101'0101'0101};
+
+// Eight characters as one word, the first in the lowest byte whatever the target's order.
+constexpr auto load8(char const* first) noexcept
+        -> std::uint64_t
+{
+        auto word = std::uint64_t{0};
+        if consteval {
+                for (auto byte = 0; byte != 8; ++byte) {
+                        word |= std::uint64_t{static_cast<unsigned char>(first[byte])} << (8 * byte);
+                }
+        } else {
+                // One unaligned load, which is what the loop above is not reliably compiled to.
+                std::memcpy(&word, first, sizeof(word));
+                if constexpr (std::endian::native == std::endian::big) {
+                        word = std::byteswap(word);
+                }
+        }
+        return word;
+}
+
+} // namespace detail
+
+// Eight decimal digits in one 64-bit word, the first the most significant, or none if any byte is not a digit.
+[[nodiscard]] constexpr auto parse_digits8(char const* first) noexcept
+        -> std::optional<std::uint32_t>
+{
+        using detail::lanes;
+        auto const word = detail::load8(first);
+
+        // A digit is 0x3 over a nibble below 10, which adding 6 does not carry out of: both nibbles tested at once.
+        auto const high_nibbles = lanes * 0xf0;
+        if (((word & high_nibbles) | (((word + lanes * 0x06) & high_nibbles) >> 4U)) != lanes * 0x33) {
+                return std::nullopt;
+        }
+
+        // Then pairs, quads and the whole: each step multiplies two fields into one twice as wide.
+        auto const digits = word & (lanes * 0x0f);
+        auto const pairs = ((digits * (10 * 0x100 + 1)) >> 8U) & 0x00ff'00ff'00ff'00ff;
+        auto const quads = ((pairs * (100 * 0x1'0000 + 1)) >> 16U) & 0x0000'ffff'0000'ffff;
+        return static_cast<std::uint32_t>((quads * (10'000 * 0x1'0000'0000 + 1)) >> 32U);
+}
+
+// Eight hexadecimal digits in one 64-bit word, letters in either case, or none if any byte is not a digit.
+[[nodiscard]] constexpr auto parse_hex_digits8(char const* first) noexcept
+        -> std::optional<std::uint32_t>
+{
+        using detail::lanes;
+        auto const word = detail::load8(first);
+
+        // Below 0x80 in every lane, no range test below borrows or carries into its neighbour.
+        auto const high_bits = lanes * 0x80;
+        if ((word & high_bits) != 0) {
+                return std::nullopt;
+        }
+
+        // Each lane's high bit set when its byte lies strictly between the bounds: Bit Twiddling Hacks' hasbetween.
+        auto const between = [word, high_bits](int below, int above) {
+                return (lanes * static_cast<std::uint64_t>(127 + above) - word) & ~word &
+                       (word + lanes * static_cast<std::uint64_t>(127 - below)) & high_bits;
+        };
+        if ((between('0' - 1, '9' + 1) | between('A' - 1, 'F' + 1) | between('a' - 1, 'f' + 1)) != high_bits) {
+                return std::nullopt;
+        }
+
+        // A letter has bit 6 set and a digit does not, which is where the 9 between their low nibbles goes.
+        auto const nibbles = (word & (lanes * 0x0f)) + 9 * ((word >> 6U) & lanes);
+        auto const pairs = ((nibbles << 4U) | (nibbles >> 8U)) & 0x00ff'00ff'00ff'00ff;
+        auto const quads = ((pairs << 8U) | (pairs >> 16U)) & 0x0000'ffff'0000'ffff;
+        return static_cast<std::uint32_t>((quads << 16U) | (quads >> 32U));
+}
+
+} // namespace xstd
+
+#endif // XSTD_CHARCONV_PARSE_DIGITS_HPP
@@ -6,29 +6,491 @@
 #ifndef XSTD_CHARCONV_TO_CHARS_HPP
 #define XSTD_CHARCONV_TO_CHARS_HPP
 
+#include <xstd/bit.hpp>                       // bit_width
 #include <xstd/concepts/integer.hpp>          // integer
+#include <xstd/contracts.hpp>                 // XSTD_AUDIT, XSTD_PRECONDITION
+#include <xstd/cstdint/bit_int.hpp>           // XSTD_HAS_BIT_INT
 #include <xstd/cstdint/int128.hpp>            // uint128
 #include <xstd/cstdlib/div.hpp>               // div
 #include <xstd/limits/numeric_limits.hpp>     // numeric_limits
+#include <xstd/type_traits/is_character.hpp>  // is_character_v
 #include <xstd/type_traits/is_signed.hpp>     // is_signed_v
 #include <xstd/type_traits/make_unsigned.hpp> // make_unsigned_t
-#include <cassert>                            // assert
+#include <algorithm>                          // max
+#include <array>                              // array
+#include <bit>                                // bit_ceil, byteswap, countr_zero, endian, has_single_bit
 #include <charconv>                           // to_chars, to_chars_result
 #include <concepts>                           // integral, same_as
 #include <cstddef>                            // ptrdiff_t, size_t
-#include <iterator>                           // distance, next
+#include <cstdint>                            // uint32_t, uint64_t
+#include <cstring>                            // memcpy
+#include <iterator>                           // distance
 #include <system_error>                       // errc
-#include <type_traits>                        // remove_cv_t
+#include <type_traits>                        // conditional_t, remove_cv_t, type_identity
 
 namespace xstd {
 
+// std::to_chars_result for any character type: where the characters end, and why not if they do not.
+template<class CharT>
+struct basic_to_chars_result
+{
+        CharT* ptr;
+        std::errc ec;
+
+        [[nodiscard]] friend constexpr auto operator==(basic_to_chars_result const&, basic_to_chars_result const&) -> bool = default;
+};
+
 namespace detail {
 
+// What to_chars returns for CharT: the standard's own result for char, as std::to_chars does, and xstd's otherwise.
+template<class CharT>
+using to_chars_result_for = std::conditional_t<std::same_as<CharT, char>, std::to_chars_result, basic_to_chars_result<CharT>>;
+
 // libc++ makes _BitInt integral, so ask the width: std::to_chars stops at its widest type.
 template<class I>
 inline constexpr auto delegates_to_std =
         std::integral<I> and (numeric_limits<I>::digits <= numeric_limits<uint128>::digits);
 
+// A pointer rather than a string_view: these are only ever subscripted.
+inline constexpr auto const* digit_chars = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+// The widest type [iterator.concept.winc]/6 converts every integer-class type to: a chunk's home.
+using chunk_type = std::size_t;
+
+// The largest power of a base that a chunk holds, and how many digits it is: 10^19 in 64 bits.
+struct chunk_radix
+{
+        chunk_type power;
+        int exponent;
+};
+
+// Indexed by the base itself, so the two entries below 2 stay value-initialized and unread.
+inline constexpr auto chunk_radices = []() {
+        auto radices = std::array<chunk_radix, 37>{};
+        for (auto base = chunk_type{2}; base < radices.size(); ++base) {
+                auto& [power, exponent] = radices[base];
+                power = 1;
+                for (; power <= numeric_limits<chunk_type>::max() / base; power *= base) {
+                        ++exponent;
+                }
+        }
+        return radices;
+}();
+
+// The count digits of a chunk, written backward to end at last, leading zeros and all; returns where they begin.
+template<class CharT>
+constexpr auto to_chars_chunk(CharT* last, chunk_type value, chunk_type radix, int count) noexcept
+        -> CharT*
+{
+        for (; count != 0; --count) {
+                *--last = static_cast<CharT>(digit_chars[value % radix]);
+                value /= radix;
+        }
+        return last;
+}
+
+// A power-of-two base's count of digits, each a mask of the low shift bits: no division.
+template<class CharT>
+constexpr auto to_chars_chunk_pow2(CharT* last, chunk_type value, int shift, int count) noexcept
+        -> CharT*
+{
+        auto const mask = (chunk_type{1} << shift) - 1;
+        for (; count != 0; --count) {
+                *--last = static_cast<CharT>(digit_chars[value & mask]);
+                value >>= shift;
+        }
+        return last;
+}
+
+// "00" through "99" back to back, so a pair of decimal digits is one lookup at twice its value.
+inline constexpr auto digit_pairs = []() {
+        auto pairs = std::array<char, 200>{};
+        for (auto i = std::size_t{0}; i < pairs.size(); i += 2) {
+                auto const tens = i / 20;
+                auto const ones = i / 2 % 10;
+                pairs[i] = digit_chars[tens];
+                pairs[i + 1] = digit_chars[ones];
+        }
+        return pairs;
+}();
+
+// Eight decimal digits of a value below 10^8 as one word, the first in the lowest byte: parse_digits8 in reverse.
+[[nodiscard]] constexpr auto digits8(std::uint32_t value) noexcept
+        -> std::uint64_t
+{
+        // Each step splits every field in two by a reciprocal multiplication, no lane carrying into the next:
+        // halves below 10^4 in 32-bit lanes, pairs below 100 in 16-bit ones, then digits in bytes.
+        auto const halves = std::uint64_t{value / 10'000} | (std::uint64_t{value % 10'000} << 32U);
+        auto const hundreds = ((halves * 10'486) >> 20U) & 0x0000'007f'0000'007f;
+        auto const pairs = hundreds | ((halves - hundreds * 100) << 16U);
+        auto const tens = ((pairs * 103) >> 10U) & 0x000f'000f'000f'000f;
+        auto const digits = tens | ((pairs - tens * 10) << 8U);
+        return digits + 0x3030'3030'3030'3030;
+}
+
+// One word as eight characters, its lowest byte first whatever the target's order.
+template<class CharT>
+constexpr auto store8(CharT* first, std::uint64_t word) noexcept
+        -> void
+{
+        if !consteval {
+                // One unaligned store, which is what the loop below is not reliably compiled to.
+                if constexpr (sizeof(CharT) == 1) {
+                        if constexpr (std::endian::native == std::endian::big) {
+                                word = std::byteswap(word);
+                        }
+                        std::memcpy(first, &word, sizeof(word));
+                        return;
+                }
+        }
+
+        // A wider character takes a byte each, which is a widening loop whichever way it is written.
+        for (auto byte = 0; byte != 8; ++byte) {
+                first[byte] = static_cast<CharT>(static_cast<unsigned char>(word >> (8 * byte)));
+        }
+}
+
+// Decimal, count digits eight at a time by digits8, and what is left two at a time, by constants multiplied away.
+template<class CharT, class C>
+constexpr auto to_chars_chunk_decimal(CharT* last, C value, int count) noexcept
+        -> CharT*
+{
+        if constexpr (numeric_limits<C>::digits > numeric_limits<std::uint32_t>::digits) {
+                for (constexpr auto eight_digits = C{100'000'000}; count >= 8; count -= 8) {
+                        auto const quotient = value / eight_digits;
+                        last -= 8;
+                        store8(last, digits8(static_cast<std::uint32_t>(value - quotient * eight_digits)));
+                        value = quotient;
+                }
+        }
+        for (; count >= 2; count -= 2) {
+                auto const quotient = value / 100;
+                auto const pair = static_cast<std::size_t>(value - quotient * 100) * 2;
+                value = quotient;
+                *--last = static_cast<CharT>(digit_pairs[pair + 1]);
+                *--last = static_cast<CharT>(digit_pairs[pair]);
+        }
+        if (count != 0) {
+                *--last = static_cast<CharT>(digit_chars[value]);
+        }
+        return last;
+}
+
+// How many digits a chunk has: one at least, and zero is that one.
+[[nodiscard]] constexpr auto chunk_size(chunk_type value, chunk_type radix) noexcept
+        -> int
+{
+        auto size = 1;
+        for (; value >= radix; value /= radix) {
+                ++size;
+        }
+        return size;
+}
+
+// The base every default argument names, and the only one besides the powers of two counted without dividing.
+inline constexpr auto decimal_radix = chunk_type{10};
+
+// The powers of ten a chunk holds, indexed by their exponent: 10^0 through 10^19.
+inline constexpr auto powers_of_ten = []() {
+        auto powers = std::array<chunk_type, static_cast<std::size_t>(chunk_radices[decimal_radix].exponent) + 1>{};
+        auto power = chunk_type{1};
+        for (auto& p : powers) {
+                p = power;
+                power *= decimal_radix;
+        }
+        return powers;
+}();
+
+// 10^exponent in U: a table entry times the chunk radix squared up, two multiplications for a uint128.
+template<class U>
+[[nodiscard]] constexpr auto power_of_ten(int exponent)
+        -> U
+{
+        // Up to a chunk wide, every exponent asked about is in the table: a single load.
+        if constexpr (numeric_limits<U>::digits <= numeric_limits<chunk_type>::digits) {
+                return static_cast<U>(powers_of_ten[static_cast<std::size_t>(exponent)]);
+        }
+        auto const [power, chunk_exponent] = chunk_radices[decimal_radix];
+        auto result = static_cast<U>(powers_of_ten[static_cast<std::size_t>(exponent % chunk_exponent)]);
+        auto big = static_cast<U>(power);
+        for (auto q = exponent / chunk_exponent; q != 0; q /= 2) {
+                if (q % 2 != 0) {
+                        result = static_cast<U>(result * big);
+                }
+                if (q > 1) {
+                        big = static_cast<U>(big * big);
+                }
+        }
+        return result;
+}
+
+// Above this many chunks, a magnitude is split by a power of the chunk radix rather than peeled a chunk at a time.
+inline constexpr auto split_threshold = 8;
+
+// The fewest bits any chunk radix spans, 59 in bases 24 and 31 in 64 bits: what bounds how many chunks a type holds.
+inline constexpr auto min_chunk_bits = []() {
+        auto bits = numeric_limits<chunk_type>::digits;
+        for (auto base = chunk_type{2}; base < chunk_radices.size(); ++base) {
+                bits = std::min(bits, static_cast<int>(std::bit_width(chunk_radices[base].power)) - 1);
+        }
+        return bits;
+}();
+
+// Only a type with more chunks than the threshold is ever split.
+template<class U>
+inline constexpr auto splits = numeric_limits<U>::digits > split_threshold * numeric_limits<chunk_type>::digits;
+
+// The chunk radix squared up, power^(2^level) at each level, as far as some count of digits needs.
+template<class U>
+struct split_powers
+{
+        std::array<U, static_cast<std::size_t>(std::bit_width(static_cast<unsigned>(numeric_limits<U>::digits / min_chunk_bits + 1)))> powers;
+        int levels;
+};
+
+// Squared only while the next level is still below count digits, so that it fits in U: one multiplication a level.
+// Never past the array either, which holds every level that a count no longer than U's own digits asks for.
+template<class U>
+[[nodiscard]] constexpr auto make_split_powers(chunk_type radix, int count)
+        -> split_powers<U>
+{
+        auto const [power, exponent] = chunk_radices[radix];
+        auto result = split_powers<U>{.powers = {}, .levels = 1};
+        result.powers[0] = static_cast<U>(power);
+        for (; (exponent << result.levels) < count and static_cast<std::size_t>(result.levels) < result.powers.size(); ++result.levels) {
+                auto const& below = result.powers[static_cast<std::size_t>(result.levels - 1)];
+                XSTD_AUDIT(below <= static_cast<U>(numeric_limits<U>::max() / below));
+                result.powers[static_cast<std::size_t>(result.levels)] = static_cast<U>(below * below);
+        }
+        XSTD_AUDIT((exponent << result.levels) >= count);
+        return result;
+}
+
+// The type a split half is written from or parsed into: as narrow as 64 bits a chunk where the type has narrower
+// siblings.
+template<class A, std::size_t Bits>
+struct split_type : std::type_identity<A>
+{};
+
+#ifdef XSTD_HAS_BIT_INT
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wbit-int-extension"
+#endif
+
+// A _BitInt has every narrower width, and a division or multiplication costs its operands' width, not their values.
+template<std::size_t N, std::size_t Bits>
+        requires (Bits < N)
+struct split_type<unsigned _BitInt(N), Bits> : std::type_identity<unsigned _BitInt(Bits)>
+{};
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+#endif
+
+template<class A, std::size_t Chunks>
+using split_type_t = typename split_type<A, static_cast<std::size_t>(numeric_limits<chunk_type>::digits) * Chunks>::type;
+
+// The chunks of digits that any value of U spans, a power of two so that it halves down to a single chunk.
+template<class U>
+inline constexpr auto max_split_chunks = std::bit_ceil(static_cast<std::size_t>(numeric_limits<U>::digits / min_chunk_bits + 1));
+
+template<class CharT, class U>
+constexpr auto to_chars_digits(CharT* last, U magnitude, chunk_type radix, int count)
+        -> void;
+
+template<class A, std::size_t Chunks, class CharT>
+constexpr auto to_chars_split(CharT* last, split_type_t<A, Chunks> magnitude, chunk_type radix, int count, split_powers<A> const& powers)
+        -> void;
+
+// |value| in the unsigned counterpart, which holds |min()|: what every digit is taken from.
+template<class I>
+[[nodiscard]] constexpr auto unsigned_magnitude(I value)
+        -> make_unsigned_t<I>
+{
+        // Well-formed and branchless when unsigned as well.
+        using U = make_unsigned_t<I>;
+        return static_cast<U>(value < static_cast<I>(0) ? U{} - static_cast<U>(value) : static_cast<U>(value));
+}
+
+// The number of digits in an unsigned magnitude, without writing them and, for the common bases, without dividing.
+template<class U>
+[[nodiscard]] constexpr auto digit_count(U magnitude, chunk_type radix)
+        -> int
+{
+        // A power-of-two base reads it off the bit width: a digit per shift bits or part thereof.
+        if (std::has_single_bit(radix)) {
+                auto const shift = std::countr_zero(radix);
+                return std::max((bit_width(magnitude) + shift - 1) / shift, 1);
+        }
+
+        // Decimal has floor(width * log10(2)) digits, or one more: a single compare against a power of ten decides.
+        if (radix == decimal_radix) {
+                // log10(2) in 64 fractional bits, a 32-bit half at a time so nothing overflows: exact up to 2^23-bit widths.
+                constexpr auto log10_2_high = std::uint64_t{0x4d10'4d42};
+                constexpr auto log10_2_low = std::uint64_t{0x7de7'fbcc};
+                constexpr auto half = 32U;
+                auto const width = static_cast<std::uint64_t>(bit_width(magnitude));
+                auto const exponent = static_cast<int>((width * log10_2_high + ((width * log10_2_low) >> half)) >> half);
+                return std::max(exponent + static_cast<int>(magnitude >= power_of_ten<U>(exponent)), 1);
+        }
+
+        // Any other base counts a chunk at a time. "rest / big" not "/=": absl::int128 is constexpr on the first only.
+        auto size = 0;
+        auto rest = magnitude;
+        if constexpr (splits<U>) {
+                // Far wider, by the split powers from the top down instead, the chunk count a bit at a time.
+                auto const exponent = chunk_radices[radix].exponent;
+                auto powers = split_powers<U>{.powers = {}, .levels = 1};
+                powers.powers[0] = static_cast<U>(chunk_radices[radix].power);
+                for (;; ++powers.levels) {
+                        auto const& top = powers.powers[static_cast<std::size_t>(powers.levels - 1)];
+                        if (top > rest / top) {
+                                break;
+                        }
+                        powers.powers[static_cast<std::size_t>(powers.levels)] = static_cast<U>(top * top);
+                }
+                for (auto level = powers.levels - 1; level >= 0; --level) {
+                        if (auto const& big = powers.powers[static_cast<std::size_t>(level)]; rest >= big) {
+                                rest = rest / big;
+                                size += exponent << level;
+                        }
+                }
+        } else if constexpr (numeric_limits<chunk_type>::digits < numeric_limits<U>::digits) {
+                auto const [power, exponent] = chunk_radices[radix];
+                for (auto const big = static_cast<U>(power); rest >= big; rest = rest / big) {
+                        size += exponent;
+                }
+        }
+        return size + chunk_size(static_cast<chunk_type>(rest), radix);
+}
+
+// The count digits of a magnitude, written backward to end at last: to_chars once it is sized and signed.
+template<class CharT, class U>
+constexpr auto to_chars_digits(CharT* last, U magnitude, chunk_type radix, int count)
+        -> void
+{
+        // Up to a chunk wide, the magnitude is its own top chunk: /6 makes the conversion modular.
+        constexpr auto chunked = numeric_limits<chunk_type>::digits < numeric_limits<U>::digits;
+
+        // Far wider, a chunk at a time is quadratic: every division's quotient is nearly as long as the magnitude.
+        if constexpr (splits<U>) {
+                if (not std::has_single_bit(radix) and count > split_threshold * chunk_radices[radix].exponent) {
+                        auto const powers = make_split_powers<U>(radix, count);
+                        to_chars_split<U, max_split_chunks<U>>(last, magnitude, radix, count, powers);
+                        return;
+                }
+        }
+
+        auto* out = last;
+        auto rest = magnitude;
+        if (std::has_single_bit(radix)) {
+                // A power-of-two base is a shift per digit, whole digits per chunk: 16 hexadecimal, or 21 octal in 63 bits.
+                auto const shift = std::countr_zero(radix);
+                auto remaining = count;
+                if constexpr (chunked) {
+                        auto const per_chunk = numeric_limits<chunk_type>::digits / shift;
+                        for (; remaining > per_chunk; remaining -= per_chunk) {
+                                out = to_chars_chunk_pow2(out, static_cast<chunk_type>(rest), shift, per_chunk);
+                                rest = rest >> static_cast<std::size_t>(per_chunk * shift);
+                        }
+                }
+                to_chars_chunk_pow2(out, static_cast<chunk_type>(rest), shift, remaining);
+        } else if (radix == decimal_radix) {
+                // The count is known, so it says how many chunks there are: no compare against 10^19 per chunk.
+                auto remaining = count;
+                if constexpr (chunked) {
+                        auto const [power, exponent] = chunk_radices[radix];
+                        for (auto const big = static_cast<U>(power); remaining > exponent; remaining -= exponent) {
+                                auto const [quotient, remainder] = xstd::div(rest, big);
+                                out = to_chars_chunk_decimal(out, static_cast<chunk_type>(remainder), exponent);
+                                rest = quotient;
+                        }
+                }
+                // A 32-bit type's digits in 32-bit arithmetic, whose reciprocal multiplications are the cheaper.
+                if constexpr (numeric_limits<U>::digits <= numeric_limits<std::uint32_t>::digits) {
+                        to_chars_chunk_decimal(out, static_cast<std::uint32_t>(rest), remaining);
+                } else {
+                        to_chars_chunk_decimal(out, static_cast<chunk_type>(rest), remaining);
+                }
+        } else {
+                // One wide division per chunk rather than per digit: 12 digits at a time, in base 36.
+                auto remaining = count;
+                if constexpr (chunked) {
+                        auto const [power, exponent] = chunk_radices[radix];
+                        for (auto const big = static_cast<U>(power); remaining > exponent; remaining -= exponent) {
+                                // Named by the library's own truncated division, both halves from one call.
+                                auto const [quotient, remainder] = xstd::div(rest, big);
+                                out = to_chars_chunk(out, static_cast<chunk_type>(remainder), radix, exponent);
+                                rest = quotient;
+                        }
+                }
+                // The top chunk padded to its count as well: below a split, it is a low half's, leading zeros and all.
+                to_chars_chunk(out, static_cast<chunk_type>(rest), radix, remaining);
+        }
+}
+
+// count digits, at most Chunks chunks of them, split in halves by the power of the chunk radix a half spans, each
+// half in a type half as wide: the divisions narrow as they go down, and the chunk loop below the threshold with them.
+template<class A, std::size_t Chunks, class CharT>
+constexpr auto to_chars_split(CharT* last, split_type_t<A, Chunks> magnitude, chunk_type radix, int count, split_powers<A> const& powers)
+        -> void
+{
+        if constexpr (Chunks <= split_threshold) {
+                to_chars_digits(last, magnitude, radix, count);
+        } else {
+                using T = split_type_t<A, Chunks>;
+                using H = split_type_t<A, Chunks / 2>;
+                constexpr auto half = Chunks / 2;
+
+                // The low half has exactly exponent * half digits, its leading zeros written; the high half has the rest.
+                auto const low_count = chunk_radices[radix].exponent * static_cast<int>(half);
+                if (count <= low_count) {
+                        to_chars_split<A, half>(last, static_cast<H>(magnitude), radix, count, powers);
+                        return;
+                }
+                auto const& power = powers.powers[static_cast<std::size_t>(std::countr_zero(half))];
+                auto const [quotient, remainder] = xstd::div(magnitude, static_cast<T>(power));
+                to_chars_split<A, half>(last, static_cast<H>(remainder), radix, low_count, powers);
+                to_chars_split<A, half>(last - low_count, static_cast<H>(quotient), radix, count - low_count, powers);
+        }
+}
+
+// Sized, signed, then the digits: to_chars wherever the standard library's is not the one called.
+template<class CharT, class I>
+[[nodiscard]] constexpr auto to_chars_sized(CharT* first, CharT* last, I value, int base)
+        -> basic_to_chars_result<CharT>
+{
+        XSTD_PRECONDITION(2 <= base and base <= 36);
+
+        // Reduced once here, not per digit: what follows is unsigned arithmetic.
+        auto const negative = value < static_cast<I>(0);
+        auto const magnitude = unsigned_magnitude(value);
+
+        // Converted rather than selected: a conditional would be one-sided when unsigned.
+        auto const sign_width = static_cast<std::ptrdiff_t>(negative);
+
+        auto const radix = static_cast<chunk_type>(base);
+
+        // Sized exactly before anything is written, the same count to_chars_size reports.
+        auto const count = digit_count(magnitude, radix);
+        auto const size = sign_width + count;
+        if (std::distance(first, last) < size) {
+                return {.ptr = last, .ec = std::errc::value_too_large};
+        }
+
+        // The size is exact, so the sign has its place before any digit does.
+        if constexpr (is_signed_v<I>) {
+                if (negative) {
+                        *first = static_cast<CharT>('-');
+                }
+        }
+
+        to_chars_digits(first + size, magnitude, radix, count);
+        return {.ptr = first + size, .ec = std::errc{}};
+}
+
 } // namespace detail
 
 // Worst case is base 2: one character per value bit, and two more when signed.
@@ -37,6 +499,19 @@ template<class I>
 inline constexpr auto to_chars_max_size =
         static_cast<std::size_t>(numeric_limits<I>::digits) + (is_signed_v<I> ? 2 : 0);
 
+// Exactly what to_chars writes for value, the sign included, so a buffer can be sized before the call.
+template<class I>
+        requires ((std::integral<I> and not std::same_as<std::remove_cv_t<I>, bool>) or integer<I>)
+// NOLINTNEXTLINE(readability-magic-numbers): the standard's own default base, see above
+[[nodiscard]] constexpr auto to_chars_size(I value, int base = 10)
+        -> std::size_t
+{
+        XSTD_PRECONDITION(2 <= base and base <= 36);
+
+        auto const negative = value < static_cast<I>(0);
+        return static_cast<std::size_t>(negative) + static_cast<std::size_t>(detail::digit_count(detail::unsigned_magnitude(value), static_cast<detail::chunk_type>(base)));
+}
+
 // The standard's own integral domain, other than its deleted bool overload.
 template<std::integral I>
         requires (not std::same_as<std::remove_cv_t<I>, bool>) and detail::delegates_to_std<I>
@@ -44,7 +519,7 @@ template<std::integral I>
 [[nodiscard]] constexpr auto to_chars(char* first, char* last, I value, int base = 10)
         -> std::to_chars_result
 {
-        assert(2 <= base and base <= 36);
+        XSTD_PRECONDITION(2 <= base and base <= 36);
         return std::to_chars(first, last, value, base);
 }
 
@@ -59,57 +534,19 @@ template<integer I>
 [[nodiscard]] constexpr auto to_chars(char* first, char* last, I value, int base = 10)
         -> std::to_chars_result
 {
-        assert(2 <= base and base <= 36);
-
-        // A pointer rather than a string_view: these are only ever subscripted.
-        static constexpr auto* digits = "0123456789abcdefghijklmnopqrstuvwxyz";
-
-        // The unsigned counterpart holds |min()| and lets both loops stop at the radix.
-        using U = make_unsigned_t<I>;
-        auto const radix = static_cast<U>(base);
-
-        // Reduced once here, not per digit; both are well-formed and branchless when unsigned.
-        auto const zero = static_cast<I>(0);
-        auto const negative = value < zero;
-        auto const magnitude = static_cast<U>(negative ? U{} - static_cast<U>(value) : static_cast<U>(value));
-
-        // Converted rather than selected: a conditional would be one-sided when unsigned.
-        auto const sign_width = static_cast<std::ptrdiff_t>(negative);
-
-        // Every value writes a digit, and a negative one a sign before it.
-        if (std::distance(first, last) < sign_width + 1) {
-                return {.ptr = last, .ec = std::errc::value_too_large};
-        }
-
-        // The walk claims a position per digit, so a step onto last is the short buffer.
-        auto* out = first + sign_width;
-        // "rest / radix" not "/=": absl::int128 is constexpr on the first only.
-        for (auto rest = magnitude; rest >= radix; rest = rest / radix) {
-                if (++out == last) {
-                        return {.ptr = last, .ec = std::errc::value_too_large};
-                }
-        }
-
-        // Taken while out still means the last digit, before the write walks it back down.
-        auto const result = std::to_chars_result{.ptr = std::next(out), .ec = std::errc{}};
-
-        // One divmod per digit, named by the library's own truncated division.
-        auto rest = magnitude;
-        while (rest >= radix) {
-                auto const [quotient, remainder] = xstd::div(rest, radix);
-                *out-- = digits[static_cast<std::size_t>(remainder)];
-                rest = quotient;
-        }
-        // The loop leaves a single digit. No decrement: unsigned, it would step below first.
-        *out = digits[static_cast<std::size_t>(rest)];
+        auto const [ptr, ec] = detail::to_chars_sized(first, last, value, base);
+        return {.ptr = ptr, .ec = ec};
+}
 
-        // Back into the position the walk reserved; here the sign is a test, not an offset.
-        if constexpr (is_signed_v<I>) {
-                if (negative) {
-                        *--out = '-';
-                }
-        }
-        return result;
+// The other character types, which std::to_chars writes none of, for every integer: the same kernels, in CharT.
+template<class CharT, class I>
+        requires (is_character_v<CharT> and not std::same_as<CharT, char>) and
+                 ((std::integral<I> and not std::same_as<std::remove_cv_t<I>, bool>) or integer<I>)
+// NOLINTNEXTLINE(readability-magic-numbers): the standard's own default base, see above
+[[nodiscard]] constexpr auto to_chars(CharT* first, CharT* last, I value, int base = 10)
+        -> basic_to_chars_result<CharT>
+{
+        return detail::to_chars_sized(first, last, value, base);
 }
 
 } // namespace xstd
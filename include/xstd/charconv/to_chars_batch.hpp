@@ -0,0 +1,121 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef XSTD_CHARCONV_TO_CHARS_BATCH_HPP
+#define XSTD_CHARCONV_TO_CHARS_BATCH_HPP
+
+#include <xstd/charconv/to_chars.hpp>         // to_chars_size, detail::chunk_type, detail::decimal_radix, detail::digits8, detail::store8, detail::to_chars_digits, detail::unsigned_magnitude
+#include <xstd/concepts/integer.hpp>          // integer
+#include <xstd/contracts.hpp>                 // XSTD_PRECONDITION
+#include <xstd/limits/numeric_limits.hpp>     // numeric_limits
+#include <xstd/type_traits/is_signed.hpp>     // is_signed_v
+#include <xstd/type_traits/make_unsigned.hpp> // make_unsigned_t
+#include <charconv>                           // to_chars_result
+#include <concepts>                           // integral, same_as
+#include <cstddef>                            // size_t
+#include <cstdint>                            // uint32_t, uint64_t
+#include <iterator>                           // distance
+#include <span>                               // span
+#include <system_error>                       // errc
+#include <type_traits>                        // remove_cv_t
+
+namespace xstd {
+
+namespace detail {
+
+// Above 32 bits, a value's decimal digits go eight at a time, wherever the slot has room below it to spill into.
+template<class U>
+inline constexpr auto spills_digits8 =
+        numeric_limits<std::uint32_t>::digits < numeric_limits<U>::digits and numeric_limits<U>::digits <= numeric_limits<std::uint64_t>::digits;
+
+// How far below its first digit to_chars_digits8_spilling may write: the leading zeros of an eight-digit group.
+inline constexpr auto digits8_spill = std::size_t{7};
+
+// The count digits of a value, written backward to end at last, a whole group of eight per store. The top group's
+// leading zeros go below the first digit, where the batch is yet to write: one store rather than a loop per digit.
+constexpr auto to_chars_digits8_spilling(char* last, std::uint64_t value, int count) noexcept
+        -> void
+{
+        constexpr auto eight_digits = std::uint64_t{100'000'000};
+        for (;; count -= 8) {
+                auto const quotient = value / eight_digits;
+                last -= 8;
+                store8(last, digits8(static_cast<std::uint32_t>(value - quotient * eight_digits)));
+                if (count <= 8) {
+                        return;
+                }
+                value = quotient;
+        }
+}
+
+} // namespace detail
+
+// Every value, delimited, into one buffer: ends[i] is where the i-th stops, counted from first, delimiter excluded.
+template<class I, std::size_t N>
+        requires ((std::integral<std::remove_cv_t<I>> and not std::same_as<std::remove_cv_t<I>, bool>) or integer<std::remove_cv_t<I>>)
+// NOLINTNEXTLINE(readability-magic-numbers): the standard's own default base, see to_chars
+[[nodiscard]] constexpr auto to_chars_batch(std::span<I, N> values, char* first, char* last, char delimiter, std::span<std::size_t> ends, int base = 10)
+        -> std::to_chars_result
+{
+        XSTD_PRECONDITION(2 <= base and base <= 36);
+        XSTD_PRECONDITION(values.size() <= ends.size());
+        using T = std::remove_cv_t<I>;
+        auto const radix = static_cast<detail::chunk_type>(base);
+
+        // Laid out in full before anything is written: the last end is the size, and one compare checks it.
+        auto size = std::size_t{0};
+        for (auto i = std::size_t{0}; i != values.size(); ++i) {
+                size += static_cast<std::size_t>(i != 0) + to_chars_size(values[i], base);
+                ends[i] = size;
+        }
+        if (static_cast<std::size_t>(std::distance(first, last)) < size) {
+                // The ends still say how large a buffer would have been enough.
+                return {.ptr = last, .ec = std::errc::value_too_large};
+        }
+
+        // Then each value into its own slot, with no further bounds check, by the kernels to_chars itself uses.
+        constexpr auto spills = detail::spills_digits8<make_unsigned_t<T>>;
+        auto const write = [=](std::size_t i) {
+                auto const begin = i == 0 ? std::size_t{0} : ends[i - 1] + 1;
+                auto const value = static_cast<T>(values[i]);
+                auto const negative = value < static_cast<T>(0);
+                auto const digits_begin = begin + static_cast<std::size_t>(negative);
+                auto const magnitude = detail::unsigned_magnitude(value);
+                auto const count = static_cast<int>(ends[i] - digits_begin);
+                if constexpr (spills) {
+                        if (radix == detail::decimal_radix and digits_begin >= detail::digits8_spill) {
+                                detail::to_chars_digits8_spilling(first + ends[i], static_cast<std::uint64_t>(magnitude), count);
+                        } else {
+                                detail::to_chars_digits(first + ends[i], magnitude, radix, count);
+                        }
+                } else {
+                        detail::to_chars_digits(first + ends[i], magnitude, radix, count);
+                }
+                if constexpr (is_signed_v<T>) {
+                        if (negative) {
+                                first[begin] = '-';
+                        }
+                }
+                if (i != 0) {
+                        first[begin - 1] = delimiter;
+                }
+        };
+        if constexpr (spills) {
+                // Back to front, so that what a group spills into is still to be written.
+                for (auto i = values.size(); i-- != 0;) {
+                        write(i);
+                }
+        } else {
+                // Front to back otherwise, which measures the faster of the two.
+                for (auto i = std::size_t{0}; i != values.size(); ++i) {
+                        write(i);
+                }
+        }
+        return {.ptr = first + size, .ec = std::errc{}};
+}
+
+} // namespace xstd
+
+#endif // XSTD_CHARCONV_TO_CHARS_BATCH_HPP
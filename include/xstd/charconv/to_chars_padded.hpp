@@ -0,0 +1,100 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef XSTD_CHARCONV_TO_CHARS_PADDED_HPP
+#define XSTD_CHARCONV_TO_CHARS_PADDED_HPP
+
+#include <xstd/charconv/to_chars.hpp>          // detail::chunk_type, detail::digit_count, detail::to_chars_digits, detail::to_chars_result_for, detail::unsigned_magnitude
+#include <xstd/concepts/integer.hpp>           // integer
+#include <xstd/contracts.hpp>                  // XSTD_PRECONDITION
+#include <xstd/type_traits/is_character.hpp>   // is_character_v
+#include <xstd/type_traits/is_signed.hpp>      // is_signed_v
+#include <algorithm>                           // fill_n, max
+#include <concepts>                            // integral, same_as
+#include <cstddef>                             // ptrdiff_t
+#include <iterator>                            // distance
+#include <system_error>                        // errc
+#include <type_traits>                         // remove_cv_t, type_identity_t
+
+namespace xstd {
+
+// At least width characters, right-aligned: a '0' fill goes between the sign and the digits, any other ahead of both.
+template<class CharT, class I>
+        requires is_character_v<CharT> and ((std::integral<I> and not std::same_as<std::remove_cv_t<I>, bool>) or integer<I>)
+// NOLINTNEXTLINE(readability-magic-numbers): the standard's own default base, see to_chars
+[[nodiscard]] constexpr auto to_chars_padded(CharT* first, CharT* last, I value, int width, std::type_identity_t<CharT> fill = static_cast<CharT>(' '), int base = 10)
+        -> detail::to_chars_result_for<CharT>
+{
+        XSTD_PRECONDITION(2 <= base and base <= 36);
+        XSTD_PRECONDITION(0 <= width);
+
+        auto const negative = value < static_cast<I>(0);
+        auto const magnitude = detail::unsigned_magnitude(value);
+        auto const radix = static_cast<detail::chunk_type>(base);
+        auto const sign_width = static_cast<int>(negative);
+
+        // Laid out in full from the exact digit count, so nothing written is ever moved.
+        auto const count = detail::digit_count(magnitude, radix);
+        auto const size = std::max(sign_width + count, width);
+        if (std::distance(first, last) < static_cast<std::ptrdiff_t>(size)) {
+                return {.ptr = last, .ec = std::errc::value_too_large};
+        }
+
+        // The value's own digits only: a width far past them would have the kernels split by powers the type cannot hold.
+        detail::to_chars_digits(first + size, magnitude, radix, count);
+        auto const padding = size - sign_width - count;
+        auto const zeros = fill == static_cast<CharT>('0');
+        if constexpr (is_signed_v<I>) {
+                if (negative) {
+                        *(zeros ? first : first + padding) = static_cast<CharT>('-');
+                }
+        }
+        std::fill_n(zeros ? first + sign_width : first, padding, fill);
+        return {.ptr = first + size, .ec = std::errc{}};
+}
+
+// The digits in groups of group from the right, a separator between each: 1,234,567 with the defaults.
+template<class CharT, class I>
+        requires is_character_v<CharT> and ((std::integral<I> and not std::same_as<std::remove_cv_t<I>, bool>) or integer<I>)
+// NOLINTNEXTLINE(readability-magic-numbers): thousands, and the standard's own default base, see to_chars
+[[nodiscard]] constexpr auto to_chars_grouped(CharT* first, CharT* last, I value, std::type_identity_t<CharT> separator = static_cast<CharT>(','), int group = 3, int base = 10)
+        -> detail::to_chars_result_for<CharT>
+{
+        XSTD_PRECONDITION(2 <= base and base <= 36);
+        XSTD_PRECONDITION(1 <= group);
+
+        auto const negative = value < static_cast<I>(0);
+        auto const magnitude = detail::unsigned_magnitude(value);
+        auto const radix = static_cast<detail::chunk_type>(base);
+        auto const sign_width = static_cast<int>(negative);
+        auto const count = detail::digit_count(magnitude, radix);
+        auto const size = sign_width + count + (count - 1) / group;
+        if (std::distance(first, last) < static_cast<std::ptrdiff_t>(size)) {
+                return {.ptr = last, .ec = std::errc::value_too_large};
+        }
+
+        // The digits by to_chars' own kernels, split and all, packed after the sign. Then spread from the right: each
+        // moves right by the separators still to its left, so none lands on one not yet moved, and when no separator
+        // is left to place, the digits still to its left are already where they belong.
+        auto* in = first + sign_width + count;
+        detail::to_chars_digits(in, magnitude, radix, count);
+        auto* out = first + size;
+        for (auto moved = 1; out != in; ++moved) {
+                *--out = *--in;
+                if (moved % group == 0) {
+                        *--out = separator;
+                }
+        }
+        if constexpr (is_signed_v<I>) {
+                if (negative) {
+                        *first = static_cast<CharT>('-');
+                }
+        }
+        return {.ptr = first + size, .ec = std::errc{}};
+}
+
+} // namespace xstd
+
+#endif // XSTD_CHARCONV_TO_CHARS_PADDED_HPP
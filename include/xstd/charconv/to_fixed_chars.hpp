@@ -0,0 +1,118 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef XSTD_CHARCONV_TO_FIXED_CHARS_HPP
+#define XSTD_CHARCONV_TO_FIXED_CHARS_HPP
+
+#include <xstd/charconv/to_chars.hpp>     // to_chars_max_size, to_chars_size, detail::chunk_type, detail::to_chars_digits, detail::unsigned_magnitude
+#include <xstd/concepts/integer.hpp>      // integer
+#include <xstd/contracts.hpp>             // XSTD_PRECONDITION
+#include <xstd/type_traits/is_signed.hpp> // is_signed_v
+#include <array>                          // array
+#include <concepts>                       // integral, same_as
+#include <cstddef>                        // size_t
+#include <string_view>                    // string_view
+#include <type_traits>                    // remove_cv_t
+
+namespace xstd {
+
+// Up to N characters, held inline: what to_fixed_chars returns, usable in a constant expression and without the heap.
+template<std::size_t N>
+class fixed_chars
+{
+        std::array<char, N> chars{};
+        std::size_t length = 0;
+
+public:
+        [[nodiscard]] constexpr fixed_chars() noexcept = default;
+
+        // Room for count characters, all written by the caller before any is read.
+        [[nodiscard]] constexpr explicit fixed_chars(std::size_t count) noexcept
+        :       length(count)
+        {
+                XSTD_PRECONDITION(count <= N);
+        }
+
+        [[nodiscard]] static constexpr auto capacity() noexcept
+                -> std::size_t
+        {
+                return N;
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept
+                -> std::size_t
+        {
+                return length;
+        }
+
+        [[nodiscard]] constexpr auto data() noexcept
+                -> char*
+        {
+                return chars.data();
+        }
+
+        [[nodiscard]] constexpr auto data() const noexcept
+                -> char const*
+        {
+                return chars.data();
+        }
+
+        [[nodiscard]] constexpr auto begin() const noexcept
+                -> char const*
+        {
+                return data();
+        }
+
+        [[nodiscard]] constexpr auto end() const noexcept
+                -> char const*
+        {
+                return data() + length;
+        }
+
+        [[nodiscard]] constexpr auto view() const noexcept
+                -> std::string_view
+        {
+                return {data(), length};
+        }
+
+        // Implicit, as std::string's is, so a fixed_chars goes wherever a string_view does.
+        [[nodiscard]] constexpr operator std::string_view() const noexcept
+        {
+                return view();
+        }
+
+        // By the characters held, not by what lies beyond them.
+        [[nodiscard]] friend constexpr auto operator==(fixed_chars const& lhs, fixed_chars const& rhs) noexcept
+                -> bool
+        {
+                return lhs.view() == rhs.view();
+        }
+};
+
+// to_chars into a value rather than a caller's buffer: always room enough, so no error to report.
+template<class I>
+        requires ((std::integral<I> and not std::same_as<std::remove_cv_t<I>, bool>) or integer<I>)
+// NOLINTNEXTLINE(readability-magic-numbers): the standard's own default base, see to_chars
+[[nodiscard]] constexpr auto to_fixed_chars(I value, int base = 10)
+        -> fixed_chars<to_chars_max_size<I>>
+{
+        XSTD_PRECONDITION(2 <= base and base <= 36);
+
+        // By the kernels to_chars itself uses, for every type alike: not every library has a constexpr std::to_chars yet.
+        auto result = fixed_chars<to_chars_max_size<I>>(to_chars_size(value, base));
+        auto const negative = value < static_cast<I>(0);
+        auto const count = static_cast<int>(result.size() - static_cast<std::size_t>(negative));
+        detail::to_chars_digits(result.data() + result.size(), detail::unsigned_magnitude(value), static_cast<detail::chunk_type>(base), count);
+        if constexpr (is_signed_v<I>) {
+                if (negative) {
+                        *result.data() = '-';
+                }
+        }
+        return result;
+}
+
+} // namespace xstd
+
+#endif // XSTD_CHARCONV_TO_FIXED_CHARS_HPP
@@ -0,0 +1,36 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef XSTD_CONTRACTS_HPP
+#define XSTD_CONTRACTS_HPP
+
+#include <cassert> // assert
+
+// How much of xstd's checking an assert-enabled build keeps: 0 none, 1 the preconditions a caller can break, 2 those
+// and the audits, postconditions and costly preconditions that re-derive a result. NDEBUG still turns all of it off.
+#ifndef XSTD_CHECK_LEVEL
+#define XSTD_CHECK_LEVEL 2
+#endif
+
+#if XSTD_CHECK_LEVEL < 0 or XSTD_CHECK_LEVEL > 2
+#error "XSTD_CHECK_LEVEL must be 0, 1 or 2"
+#endif
+
+// A check left out is not evaluated: sizeof keeps its names used and its syntax checked, and costs nothing.
+#define XSTD_CHECK_UNEVALUATED(...) static_cast<void>(sizeof(static_cast<bool>(__VA_ARGS__)))
+
+#if XSTD_CHECK_LEVEL >= 1
+#define XSTD_PRECONDITION(...) assert(__VA_ARGS__)
+#else
+#define XSTD_PRECONDITION(...) XSTD_CHECK_UNEVALUATED(__VA_ARGS__)
+#endif
+
+#if XSTD_CHECK_LEVEL >= 2
+#define XSTD_AUDIT(...) assert(__VA_ARGS__)
+#else
+#define XSTD_AUDIT(...) XSTD_CHECK_UNEVALUATED(__VA_ARGS__)
+#endif
+
+#endif // XSTD_CONTRACTS_HPP
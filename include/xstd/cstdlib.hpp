@@ -16,5 +16,10 @@
 #include <xstd/cstdlib/div.hpp>          // IWYU pragma: export; div
 #include <xstd/cstdlib/div_euclid.hpp>   // IWYU pragma: export; div_euclid
 #include <xstd/cstdlib/div_floor.hpp>    // IWYU pragma: export; div_floor
+#include <xstd/cstdlib/rem_euclid.hpp>   // IWYU pragma: export; rem_euclid
+#include <xstd/cstdlib/rem_floor.hpp>    // IWYU pragma: export; rem_floor
+#include <xstd/cstdlib/divider.hpp>      // IWYU pragma: export; divider
+#include <xstd/cstdlib/div_span.hpp>     // IWYU pragma: export; div, div_euclid, div_floor over spans
+#include <xstd/cstdlib/div_exact.hpp>    // IWYU pragma: export; div_exact, exact_divider, is_divisible
 
 #endif // XSTD_CSTDLIB_HPP
@@ -8,9 +8,9 @@
 
 #include <xstd/concepts/integer.hpp>                 // integer
 #include <xstd/concepts/nothrow_const_operators.hpp> // nothrow_const_operators
+#include <xstd/contracts.hpp>                        // XSTD_PRECONDITION
 #include <xstd/limits/numeric_limits.hpp>            // numeric_limits
 #include <xstd/type_traits/is_unsigned.hpp>          // is_unsigned_v
-#include <cassert>                                   // assert
 
 namespace xstd {
 
@@ -24,7 +24,7 @@ template<integer I>
                 return x;
         } else {
                 auto const zero = static_cast<I>(0);
-                assert(x != numeric_limits<I>::min()); // -x would overflow
+                XSTD_PRECONDITION(x != numeric_limits<I>::min()); // -x would overflow
                 return static_cast<I>(x < zero ? -x : x);
         }
 }
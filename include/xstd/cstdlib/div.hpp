@@ -8,31 +8,145 @@
 
 #include <xstd/concepts/integer.hpp>                 // integer
 #include <xstd/concepts/nothrow_const_operators.hpp> // nothrow_const_operators
+#include <xstd/contracts.hpp>                        // XSTD_AUDIT, XSTD_PRECONDITION
+#include <xstd/cstdint/int128.hpp>                   // int128, uint128
 #include <xstd/cstdlib/div_result.hpp>               // IWYU pragma: export; div_result
 #include <xstd/cstdlib/sign.hpp>                     // sign
 #include <xstd/cstdlib/unsigned_abs.hpp>             // unsigned_abs
 #include <xstd/limits/numeric_limits.hpp>            // numeric_limits
 #include <xstd/type_traits/is_signed.hpp>            // is_signed_v
-#include <cassert>                                   // assert
+#include <bit>                                       // countl_zero
+#include <concepts>                                  // same_as
+#include <cstdint>                                   // uint64_t
 
 namespace xstd {
 
+namespace detail {
+
+// The compiler's own 128-bit types, whose / and % are a library call even for a denominator that fits in 64 bits.
+#if defined(__SIZEOF_INT128__) and not defined(_MSC_VER)
+template<class I>
+inline constexpr bool has_narrow_division = std::same_as<I, int128> or std::same_as<I, uint128>;
+#else
+template<class I>
+inline constexpr bool has_narrow_division = false;
+#endif
+
+// (high * 2^64 + low) / denom for high < denom, so that the quotient fits: what x86-64's divq does in one instruction.
+[[nodiscard]] inline auto div_128_by_64(std::uint64_t high, std::uint64_t low, std::uint64_t denom) noexcept
+        -> div_result<std::uint64_t>
+{
+        XSTD_AUDIT(high < denom);
+#if defined(__x86_64__) and (defined(__GNUC__) or defined(__clang__))
+        auto quotient = std::uint64_t{0};
+        auto remainder = std::uint64_t{0};
+        asm("divq %[denom]" : "=a"(quotient), "=d"(remainder) : [denom] "rm"(denom), "a"(low), "d"(high));
+        return {.quotient = quotient, .remainder = remainder};
+#else
+        // Hacker's Delight's divlu: the denominator normalized, then two 32-bit quotient digits, each corrected at most twice.
+        constexpr auto half = 32;
+        constexpr auto base = std::uint64_t{1} << half;
+        constexpr auto mask = base - 1;
+        auto const shift = std::countl_zero(denom);
+        auto const d = denom << shift;
+        auto const d1 = d >> half;
+        auto const d0 = d & mask;
+        auto const n32 = shift == 0 ? high : (high << shift) | (low >> (64 - shift));
+        auto const n10 = low << shift;
+        auto const n1 = n10 >> half;
+        auto const n0 = n10 & mask;
+        auto const digit = [&](std::uint64_t numer, std::uint64_t next) {
+                auto q = numer / d1;
+                auto rhat = numer - q * d1;
+                while (q >= base or q * d0 > ((rhat << half) | next)) {
+                        --q;
+                        rhat += d1;
+                        if (rhat >= base) {
+                                break;
+                        }
+                }
+                return q;
+        };
+        auto const q1 = digit(n32, n1);
+        auto const n21 = ((n32 << half) | n1) - q1 * d;
+        auto const q0 = digit(n21, n0);
+        auto const r = ((n21 << half) | n0) - q0 * d;
+        return {.quotient = (q1 << half) | q0, .remainder = r >> shift};
+#endif
+}
+
+// Magnitudes whose denominator fits in 64 bits divided in at most two 64-bit steps; any other by / and %.
+template<class I>
+[[nodiscard]] inline auto div_narrow(I numer, I denom) noexcept
+        -> div_result<I>
+{
+        constexpr auto word = 64U;
+        auto const n = xstd::unsigned_abs(numer);
+        auto const d = xstd::unsigned_abs(denom);
+        if ((d >> word) != 0) {
+                return {.quotient = static_cast<I>(numer / denom), .remainder = static_cast<I>(numer % denom)};
+        }
+        auto const d64 = static_cast<std::uint64_t>(d);
+        auto const high = static_cast<std::uint64_t>(n >> word);
+        // Only a quotient wider than 64 bits needs the first step; a numerator below 2^64 skips straight past it.
+        auto const high_quotient = high < d64 ? std::uint64_t{0} : high / d64;
+        auto const [low_quotient, r] = div_128_by_64(high - high_quotient * d64, static_cast<std::uint64_t>(n), d64);
+        auto q = static_cast<decltype(n)>((static_cast<decltype(n)>(high_quotient) << word) | low_quotient);
+        auto rest = static_cast<decltype(n)>(r);
+        if constexpr (is_signed_v<I>) {
+                if ((numer < 0) != (denom < 0)) {
+                        q = -q;
+                }
+                if (numer < 0) {
+                        rest = -rest;
+                }
+        }
+        return {.quotient = static_cast<I>(q), .remainder = static_cast<I>(rest)};
+}
+
+// The quotient and remainder, by the narrow path where there is one and the evaluation is not constant.
+template<integer I>
+[[nodiscard]] constexpr auto div_truncated(I numer, I denom) noexcept(nothrow_const_operators<I>)
+        -> div_result<I>
+{
+        if constexpr (has_narrow_division<I>) {
+                if !consteval {
+                        return div_narrow(numer, denom);
+                }
+        }
+        return {.quotient = static_cast<I>(numer / denom), .remainder = static_cast<I>(numer % denom)};
+}
+
+// The remainder alone, by the same path: % where there is no narrow one.
+template<integer I>
+[[nodiscard]] constexpr auto rem_truncated(I numer, I denom) noexcept(nothrow_const_operators<I>)
+        -> I
+{
+        if constexpr (has_narrow_division<I>) {
+                if !consteval {
+                        return div_narrow(numer, denom).remainder;
+                }
+        }
+        return static_cast<I>(numer % denom);
+}
+
+} // namespace detail
+
 // Truncated division, as specified by [expr.mul].
 template<integer I>
 [[nodiscard]] constexpr auto div(I numer, I denom) noexcept(nothrow_const_operators<I>)
         -> div_result<I>
 {
-        assert(denom != static_cast<I>(0));
+        XSTD_PRECONDITION(denom != static_cast<I>(0));
         // Only a signed type has a MIN to reach it with; unsigned, this refuses div(0, max).
         if constexpr (is_signed_v<I>) {
-                assert(numer != numeric_limits<I>::min() or denom != static_cast<I>(-1));
+                XSTD_PRECONDITION(numer != numeric_limits<I>::min() or denom != static_cast<I>(-1));
         }
-        auto const qT = static_cast<I>(numer / denom);
-        auto const rT = static_cast<I>(numer % denom);
-        assert(numer == static_cast<I>(static_cast<I>(denom * qT) + rT));
+        auto const [qT, rT] = detail::div_truncated(numer, denom);
+        XSTD_AUDIT(numer == static_cast<I>(static_cast<I>(denom * qT) + rT));
         // Said on the counterpart every integer type has, |MIN| fitting in no other.
-        assert(xstd::unsigned_abs(rT) < xstd::unsigned_abs(denom));
-        assert(xstd::sign(rT) == xstd::sign(numer) or rT == static_cast<I>(0));
+        XSTD_AUDIT(xstd::unsigned_abs(rT) < xstd::unsigned_abs(denom));
+        XSTD_AUDIT(xstd::sign(rT) == xstd::sign(numer) or rT == static_cast<I>(0));
         return {.quotient = qT, .remainder = rT};
 }
 
@@ -8,39 +8,51 @@
 
 #include <xstd/concepts/integer.hpp>                 // integer
 #include <xstd/concepts/nothrow_const_operators.hpp> // nothrow_const_operators
+#include <xstd/contracts.hpp>                        // XSTD_AUDIT, XSTD_PRECONDITION
 #include <xstd/cstdlib/div.hpp>                      // div
 #include <xstd/cstdlib/div_result.hpp>               // IWYU pragma: export; div_result
 #include <xstd/cstdlib/sign.hpp>                     // sign
 #include <xstd/cstdlib/unsigned_abs.hpp>             // unsigned_abs
 #include <xstd/type_traits/is_unsigned.hpp>          // is_unsigned_v
-#include <cassert>                                   // assert
 
 namespace xstd {
 
-// Euclidean division: the remainder is nonnegative.
+namespace detail {
+
+// A truncated result moved to the Euclidean one, wherever the truncated one came from.
 template<integer I>
-[[nodiscard]] constexpr auto div_euclid(I numer, I denom) noexcept(nothrow_const_operators<I>)
+[[nodiscard]] constexpr auto euclid_from_truncated(div_result<I> truncated, I denom) noexcept(nothrow_const_operators<I>)
         -> div_result<I>
 {
-        assert(denom != static_cast<I>(0));
         // An unsigned truncated remainder is already nonnegative, so it is the answer.
         if constexpr (is_unsigned_v<I>) {
-                // Qualified: unqualified, ADL finds Boost.Int128's own div and it wins.
-                return xstd::div(numer, denom);
+                return truncated;
         } else {
-                auto const [qT, rT] = xstd::div(numer, denom);
+                auto const [qT, rT] = truncated;
                 auto const zero = static_cast<I>(0);
                 auto const one = static_cast<I>(1);
                 auto const adjust = rT < zero;
                 auto const qE = adjust ? (denom > zero ? static_cast<I>(qT - one) : static_cast<I>(qT + one)) : qT;
                 auto const rE = adjust ? (denom > zero ? static_cast<I>(rT + denom) : static_cast<I>(rT - denom)) : rT;
                 // Said on the counterpart every integer type has, |MIN| fitting in no other.
-                assert(xstd::unsigned_abs(rE) < xstd::unsigned_abs(denom));
-                assert(xstd::sign(rE) >= 0);
+                XSTD_AUDIT(xstd::unsigned_abs(rE) < xstd::unsigned_abs(denom));
+                XSTD_AUDIT(xstd::sign(rE) >= 0);
                 return {.quotient = qE, .remainder = rE};
         }
 }
 
+} // namespace detail
+
+// Euclidean division: the remainder is nonnegative.
+template<integer I>
+[[nodiscard]] constexpr auto div_euclid(I numer, I denom) noexcept(nothrow_const_operators<I>)
+        -> div_result<I>
+{
+        XSTD_PRECONDITION(denom != static_cast<I>(0));
+        // Qualified: unqualified, ADL finds Boost.Int128's own div and it wins.
+        return detail::euclid_from_truncated(xstd::div(numer, denom), denom);
+}
+
 } // namespace xstd
 
 #endif // XSTD_CSTDLIB_DIV_EUCLID_HPP
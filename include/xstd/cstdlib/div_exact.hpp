@@ -0,0 +1,181 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef XSTD_CSTDLIB_DIV_EXACT_HPP
+#define XSTD_CSTDLIB_DIV_EXACT_HPP
+
+#include <xstd/bit.hpp>                              // countr_zero
+#include <xstd/concepts/integer.hpp>                 // integer
+#include <xstd/concepts/nothrow_const_operators.hpp> // nothrow_const_operators
+#include <xstd/concepts/unsigned_integer.hpp>        // unsigned_integer
+#include <xstd/contracts.hpp>                        // XSTD_AUDIT, XSTD_PRECONDITION
+#include <xstd/cstdlib/div.hpp>                      // detail::rem_truncated
+#include <xstd/cstdlib/unsigned_abs.hpp>             // unsigned_abs
+#include <xstd/limits/numeric_limits.hpp>            // numeric_limits
+#include <xstd/type_traits/is_signed.hpp>            // is_signed_v
+#include <xstd/type_traits/make_unsigned.hpp>        // make_unsigned_t
+#include <cstddef>                                   // size_t
+
+namespace xstd {
+
+namespace detail {
+
+// a * b modulo 2^digits: a type narrower than int is multiplied as unsigned int, so that it wraps instead of overflowing.
+template<unsigned_integer U>
+[[nodiscard]] constexpr auto mul_wrap(U a, U b) noexcept(nothrow_const_operators<U>)
+        -> U
+{
+        if constexpr (numeric_limits<U>::digits < numeric_limits<unsigned>::digits) {
+                return static_cast<U>(static_cast<unsigned>(a) * static_cast<unsigned>(b));
+        } else {
+                return static_cast<U>(a * b);
+        }
+}
+
+// The inverse of an odd value modulo 2^digits, by Newton's iteration: x = 3d ^ 2 is right in the low five bits, and
+// each step doubles that, so five steps cover 128 bits.
+template<unsigned_integer U>
+[[nodiscard]] constexpr auto inverse_odd(U odd) noexcept(nothrow_const_operators<U>)
+        -> U
+{
+        XSTD_AUDIT(static_cast<U>(odd & U{1}) == U{1});
+        auto x = static_cast<U>(mul_wrap(odd, U{3}) ^ U{2});
+        for (auto bits = 5; bits < numeric_limits<U>::digits; bits *= 2) {
+                x = mul_wrap(x, static_cast<U>(U{2} - mul_wrap(odd, x)));
+        }
+        XSTD_AUDIT(mul_wrap(odd, x) == U{1});
+        return x;
+}
+
+// A denominator split into its odd part's inverse and its power of two: all that an exact quotient needs.
+template<unsigned_integer U>
+struct odd_inverse
+{
+        U inverse = U{0};
+        int shift = 0;
+
+        [[nodiscard]] constexpr explicit odd_inverse(U d) noexcept(nothrow_const_operators<U>)
+        {
+                XSTD_PRECONDITION(d != U{0});
+                shift = xstd::countr_zero(d);
+                inverse = inverse_odd(static_cast<U>(d >> static_cast<std::size_t>(shift)));
+        }
+
+        // n / d for a multiple n of d: the power of two shifted out, the odd part multiplied away.
+        [[nodiscard]] constexpr auto quotient(U n) const noexcept(nothrow_const_operators<U>)
+                -> U
+        {
+                return mul_wrap(static_cast<U>(n >> static_cast<std::size_t>(shift)), inverse);
+        }
+};
+
+// Signed, the magnitudes' quotient takes the sign the operands agree or disagree on.
+template<integer I>
+[[nodiscard]] constexpr auto div_exact_magnitudes(I numer, I denom, odd_inverse<make_unsigned_t<I>> const& by) noexcept(nothrow_const_operators<I>)
+        -> I
+{
+        using U = make_unsigned_t<I>;
+        if constexpr (is_signed_v<I>) {
+                XSTD_PRECONDITION(numer != numeric_limits<I>::min() or denom != static_cast<I>(-1));
+        }
+        auto q = by.quotient(xstd::unsigned_abs(numer));
+        if constexpr (is_signed_v<I>) {
+                if ((numer < static_cast<I>(0)) != (denom < static_cast<I>(0))) {
+                        q = static_cast<U>(U{0} - q);
+                }
+        }
+        auto const qT = static_cast<I>(q);
+        XSTD_AUDIT(numer == static_cast<I>(denom * qT));
+        return qT;
+}
+
+} // namespace detail
+
+// A denominator fixed at run time, prepared for exact division and for divisibility tests: the inverse of its odd
+// part modulo 2^digits, its power of two, and the largest quotient that a multiple of it can have.
+template<integer I>
+class exact_divider
+{
+        using U = make_unsigned_t<I>;
+
+        I denom;
+        detail::odd_inverse<U> by;
+        U limit;
+
+public:
+        [[nodiscard]] constexpr explicit exact_divider(I d) noexcept(nothrow_const_operators<I>)
+        :       denom(d)
+        ,       by(xstd::unsigned_abs(d))
+        ,       limit(static_cast<U>(numeric_limits<U>::max() / xstd::unsigned_abs(d)))
+        {
+                XSTD_PRECONDITION(d != static_cast<I>(0));
+        }
+
+        [[nodiscard]] constexpr auto denominator() const noexcept
+                -> I
+        {
+                return denom;
+        }
+
+        [[nodiscard]] constexpr auto odd_part() const noexcept
+                -> detail::odd_inverse<U> const&
+        {
+                return by;
+        }
+
+        // Granlund and Montgomery: the inverse maps the multiples of the odd part onto 0 through limit and every other
+        // value above it; rotating right by the power of two moves any low set bit up there as well.
+        [[nodiscard]] constexpr auto divides(U n) const noexcept(nothrow_const_operators<I>)
+                -> bool
+        {
+                auto const product = detail::mul_wrap(n, by.inverse);
+                if (by.shift == 0) {
+                        return product <= limit;
+                }
+                auto const low = static_cast<U>(product >> static_cast<std::size_t>(by.shift));
+                auto const high = static_cast<U>(product << static_cast<std::size_t>(numeric_limits<U>::digits - by.shift));
+                return static_cast<U>(low | high) <= limit;
+        }
+};
+
+// numer / denom where denom is known to divide numer: a multiplication and a shift, where div pays for a division.
+template<integer I>
+[[nodiscard]] constexpr auto div_exact(I numer, I denom) noexcept(nothrow_const_operators<I>)
+        -> I
+{
+        XSTD_PRECONDITION(denom != static_cast<I>(0));
+        XSTD_AUDIT(detail::rem_truncated(xstd::unsigned_abs(numer), xstd::unsigned_abs(denom)) == make_unsigned_t<I>{0});
+        return detail::div_exact_magnitudes(numer, denom, detail::odd_inverse(xstd::unsigned_abs(denom)));
+}
+
+template<integer I>
+[[nodiscard]] constexpr auto div_exact(I numer, exact_divider<I> const& denom) noexcept(nothrow_const_operators<I>)
+        -> I
+{
+        XSTD_AUDIT(denom.divides(xstd::unsigned_abs(numer)));
+        return detail::div_exact_magnitudes(numer, denom.denominator(), denom.odd_part());
+}
+
+// Without a prepared divider, one remainder is cheaper than the division a divider's limit costs.
+template<integer I>
+[[nodiscard]] constexpr auto is_divisible(I numer, I denom) noexcept(nothrow_const_operators<I>)
+        -> bool
+{
+        XSTD_PRECONDITION(denom != static_cast<I>(0));
+        // On the magnitudes: MIN % -1 is as undefined as MIN / -1, and divisibility does not depend on sign.
+        return detail::rem_truncated(xstd::unsigned_abs(numer), xstd::unsigned_abs(denom)) == make_unsigned_t<I>{0};
+}
+
+// With one: a multiplication, a rotation and a comparison.
+template<integer I>
+[[nodiscard]] constexpr auto is_divisible(I numer, exact_divider<I> const& denom) noexcept(nothrow_const_operators<I>)
+        -> bool
+{
+        return denom.divides(xstd::unsigned_abs(numer));
+}
+
+} // namespace xstd
+
+#endif // XSTD_CSTDLIB_DIV_EXACT_HPP
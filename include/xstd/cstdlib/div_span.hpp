@@ -0,0 +1,174 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef XSTD_CSTDLIB_DIV_SPAN_HPP
+#define XSTD_CSTDLIB_DIV_SPAN_HPP
+
+#include <xstd/concepts/integer.hpp>                 // integer
+#include <xstd/concepts/nothrow_const_operators.hpp> // nothrow_const_operators
+#include <xstd/contracts.hpp>                        // XSTD_PRECONDITION
+#include <xstd/cstdlib/div.hpp>                      // div
+#include <xstd/cstdlib/div_euclid.hpp>               // detail::euclid_from_truncated
+#include <xstd/cstdlib/div_floor.hpp>                // detail::floor_from_truncated
+#include <xstd/cstdlib/div_result.hpp>               // IWYU pragma: export; div_result
+#include <xstd/cstdlib/divider.hpp>                  // divider, div
+#include <xstd/limits/numeric_limits.hpp>            // numeric_limits
+#include <xstd/type_traits/is_signed.hpp>            // is_signed_v
+#include <concepts>                                  // constructible_from, integral, same_as
+#include <cstddef>                                   // size_t
+#include <span>                                      // span
+#include <type_traits>                               // remove_cv_t, remove_cvref_t
+
+namespace xstd {
+
+namespace detail {
+
+// Truncated division of one pair. Up to 32 bits, a double holds both operands and the quotient rounds to within
+// less than 1 / |denom| of the exact one, so truncating it is exact: a division that vectorizes, where idiv does not.
+template<integer I>
+[[nodiscard]] constexpr auto div_elementwise(I numer, I denom) noexcept(nothrow_const_operators<I>)
+        -> div_result<I>
+{
+        if constexpr (std::integral<I> and numeric_limits<I>::digits <= 32) {
+                XSTD_PRECONDITION(denom != static_cast<I>(0));
+                if constexpr (is_signed_v<I>) {
+                        XSTD_PRECONDITION(numer != numeric_limits<I>::min() or denom != static_cast<I>(-1));
+                }
+                auto const quotient = static_cast<I>(static_cast<double>(numer) / static_cast<double>(denom));
+                return {.quotient = quotient, .remainder = static_cast<I>(numer - quotient * denom)};
+        } else {
+                return xstd::div(numer, denom);
+        }
+}
+
+// One denominator for all, of the numerators' own type so that nothing converts it silently, or a range of them with
+// one per numerator.
+template<class D, class T>
+concept denominators = std::same_as<std::remove_cvref_t<D>, T> or std::constructible_from<std::span<T const>, D const&>;
+
+// The same denominator for every numerator: its reciprocal once, then a multiplication and shifts per element.
+template<integer T, class Adjust, class Store>
+constexpr auto div_by_one(std::span<T const> numer, T denom, Adjust adjust, Store store)
+        -> void
+{
+        auto const by = divider<T>(denom);
+        for (auto i = std::size_t{0}; i != numer.size(); ++i) {
+                store(i, adjust(xstd::div(numer[i], by), denom));
+        }
+}
+
+// A denominator per numerator: no reciprocal pays for itself, so the division that vectorizes best.
+template<integer T, class Adjust, class Store>
+constexpr auto div_by_each(std::span<T const> numer, std::span<T const> denom, Adjust adjust, Store store)
+        -> void
+{
+        XSTD_PRECONDITION(denom.size() == numer.size());
+        for (auto i = std::size_t{0}; i != numer.size(); ++i) {
+                store(i, adjust(detail::div_elementwise(numer[i], denom[i]), denom[i]));
+        }
+}
+
+template<integer T, class D, class Adjust, class Store>
+constexpr auto div_into(std::span<T const> numer, D const& denom, Adjust adjust, Store store)
+        -> void
+{
+        if constexpr (std::same_as<D, T>) {
+                detail::div_by_one(numer, denom, adjust, store);
+        } else {
+                detail::div_by_each(numer, std::span<T const>(denom), adjust, store);
+        }
+}
+
+// Structure of arrays: quotients and remainders each contiguous, for whatever consumes them next.
+template<integer T, class D, class Adjust>
+constexpr auto div_each(std::span<T const> numer, D const& denom, std::span<T> quotient, std::span<T> remainder, Adjust adjust)
+        -> void
+{
+        XSTD_PRECONDITION(quotient.size() == numer.size());
+        XSTD_PRECONDITION(remainder.size() == numer.size());
+        detail::div_into(numer, denom, adjust, [=](std::size_t i, div_result<T> result) {
+                quotient[i] = result.quotient;
+                remainder[i] = result.remainder;
+        });
+}
+
+// Array of structures: one div_result per numerator.
+template<integer T, class D, class Adjust>
+constexpr auto div_each(std::span<T const> numer, D const& denom, std::span<div_result<T>> result, Adjust adjust)
+        -> void
+{
+        XSTD_PRECONDITION(result.size() == numer.size());
+        detail::div_into(numer, denom, adjust, [=](std::size_t i, div_result<T> r) {
+                result[i] = r;
+        });
+}
+
+inline constexpr auto truncated = [](auto result, auto) {
+        return result;
+};
+
+inline constexpr auto floored = [](auto result, auto denom) {
+        return detail::floor_from_truncated(result, denom);
+};
+
+inline constexpr auto euclidean = [](auto result, auto denom) {
+        return detail::euclid_from_truncated(result, denom);
+};
+
+} // namespace detail
+
+// Elementwise div, div_floor and div_euclid: numer[i] by denom, or by denom[i] when it is a range, into quotient[i]
+// and remainder[i] or into result[i]. Each element's result and preconditions are those of the scalar overload.
+template<class I, std::size_t N, class D>
+        requires integer<std::remove_cv_t<I>> and detail::denominators<D, std::remove_cv_t<I>>
+constexpr auto div(std::span<I, N> numer, D const& denom, std::span<std::remove_cv_t<I>> quotient, std::span<std::remove_cv_t<I>> remainder)
+        -> void
+{
+        detail::div_each(std::span<std::remove_cv_t<I> const>(numer), denom, quotient, remainder, detail::truncated);
+}
+
+template<class I, std::size_t N, class D>
+        requires integer<std::remove_cv_t<I>> and detail::denominators<D, std::remove_cv_t<I>>
+constexpr auto div(std::span<I, N> numer, D const& denom, std::span<div_result<std::remove_cv_t<I>>> result)
+        -> void
+{
+        detail::div_each(std::span<std::remove_cv_t<I> const>(numer), denom, result, detail::truncated);
+}
+
+template<class I, std::size_t N, class D>
+        requires integer<std::remove_cv_t<I>> and detail::denominators<D, std::remove_cv_t<I>>
+constexpr auto div_floor(std::span<I, N> numer, D const& denom, std::span<std::remove_cv_t<I>> quotient, std::span<std::remove_cv_t<I>> remainder)
+        -> void
+{
+        detail::div_each(std::span<std::remove_cv_t<I> const>(numer), denom, quotient, remainder, detail::floored);
+}
+
+template<class I, std::size_t N, class D>
+        requires integer<std::remove_cv_t<I>> and detail::denominators<D, std::remove_cv_t<I>>
+constexpr auto div_floor(std::span<I, N> numer, D const& denom, std::span<div_result<std::remove_cv_t<I>>> result)
+        -> void
+{
+        detail::div_each(std::span<std::remove_cv_t<I> const>(numer), denom, result, detail::floored);
+}
+
+template<class I, std::size_t N, class D>
+        requires integer<std::remove_cv_t<I>> and detail::denominators<D, std::remove_cv_t<I>>
+constexpr auto div_euclid(std::span<I, N> numer, D const& denom, std::span<std::remove_cv_t<I>> quotient, std::span<std::remove_cv_t<I>> remainder)
+        -> void
+{
+        detail::div_each(std::span<std::remove_cv_t<I> const>(numer), denom, quotient, remainder, detail::euclidean);
+}
+
+template<class I, std::size_t N, class D>
+        requires integer<std::remove_cv_t<I>> and detail::denominators<D, std::remove_cv_t<I>>
+constexpr auto div_euclid(std::span<I, N> numer, D const& denom, std::span<div_result<std::remove_cv_t<I>>> result)
+        -> void
+{
+        detail::div_each(std::span<std::remove_cv_t<I> const>(numer), denom, result, detail::euclidean);
+}
+
+} // namespace xstd
+
+#endif // XSTD_CSTDLIB_DIV_SPAN_HPP
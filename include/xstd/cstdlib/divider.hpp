@@ -0,0 +1,292 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef XSTD_CSTDLIB_DIVIDER_HPP
+#define XSTD_CSTDLIB_DIVIDER_HPP
+
+#include <xstd/bit.hpp>                              // bit_width
+#include <xstd/concepts/integer.hpp>                 // integer
+#include <xstd/concepts/nothrow_const_operators.hpp> // nothrow_const_operators
+#include <xstd/concepts/unsigned_integer.hpp>        // unsigned_integer
+#include <xstd/contracts.hpp>                        // XSTD_AUDIT, XSTD_PRECONDITION
+#include <xstd/cstdint/int128.hpp>                   // uint128
+#include <xstd/cstdlib/div_euclid.hpp>               // detail::euclid_from_truncated
+#include <xstd/cstdlib/div_floor.hpp>                // detail::floor_from_truncated
+#include <xstd/cstdlib/div_result.hpp>               // IWYU pragma: export; div_result
+#include <xstd/cstdlib/unsigned_abs.hpp>             // unsigned_abs
+#include <xstd/limits/numeric_limits.hpp>            // numeric_limits
+#include <xstd/type_traits/is_signed.hpp>            // is_signed_v
+#include <xstd/type_traits/make_unsigned.hpp>        // make_unsigned_t
+#include <concepts>                                  // integral
+#include <cstddef>                                   // size_t
+#include <cstdint>                                   // uint32_t, uint64_t
+
+namespace xstd {
+
+namespace detail {
+
+// The high half of the double-width product: in a type twice as wide where there is one, else by half-width pieces.
+template<unsigned_integer U>
+[[nodiscard]] constexpr auto mul_high(U a, U b) noexcept(nothrow_const_operators<U>)
+        -> U
+{
+        constexpr auto digits = numeric_limits<U>::digits;
+        if constexpr (digits <= numeric_limits<std::uint32_t>::digits) {
+                return static_cast<U>((static_cast<std::uint64_t>(a) * static_cast<std::uint64_t>(b)) >> static_cast<unsigned>(digits));
+        } else if constexpr (digits <= numeric_limits<std::uint64_t>::digits) {
+                return static_cast<U>((static_cast<uint128>(a) * static_cast<uint128>(b)) >> static_cast<unsigned>(digits));
+        } else if constexpr (digits % 2 == 0) {
+                // Four half-width products, none of which overflows, and the carries out of the middle column.
+                constexpr auto half = static_cast<std::size_t>(digits / 2);
+                auto const mask = static_cast<U>(static_cast<U>(U{1} << half) - U{1});
+                auto const a0 = static_cast<U>(a & mask);
+                auto const a1 = static_cast<U>(a >> half);
+                auto const b0 = static_cast<U>(b & mask);
+                auto const b1 = static_cast<U>(b >> half);
+                auto const p01 = static_cast<U>(a0 * b1);
+                auto const p10 = static_cast<U>(a1 * b0);
+                auto const middle = static_cast<U>(static_cast<U>(static_cast<U>(a0 * b0) >> half) + static_cast<U>(p01 & mask) + static_cast<U>(p10 & mask));
+                return static_cast<U>(static_cast<U>(a1 * b1) + static_cast<U>(p01 >> half) + static_cast<U>(p10 >> half) + static_cast<U>(middle >> half));
+        } else {
+                // An odd width has no halves that multiply without overflow: shift and add, a bit at a time.
+                auto high = U{0};
+                auto low = U{0};
+                for (auto bit = digits; bit-- != 0;) {
+                        high = static_cast<U>(static_cast<U>(high << std::size_t{1}) | static_cast<U>(low >> static_cast<std::size_t>(digits - 1)));
+                        low = static_cast<U>(low << std::size_t{1});
+                        if (static_cast<U>(static_cast<U>(b >> static_cast<std::size_t>(bit)) & U{1}) != U{0}) {
+                                auto const sum = static_cast<U>(low + a);
+                                high = static_cast<U>(high + static_cast<U>(sum < low ? U{1} : U{0}));
+                                low = sum;
+                        }
+                }
+                return high;
+        }
+}
+
+// (high * 2^digits) / denom and its remainder, for high < denom so the quotient fits: once per divisor, not per division.
+template<unsigned_integer U>
+[[nodiscard]] constexpr auto div_wide(U high, U denom) noexcept(nothrow_const_operators<U>)
+        -> div_result<U>
+{
+        XSTD_AUDIT(high < denom);
+        constexpr auto digits = numeric_limits<U>::digits;
+        if constexpr (digits <= numeric_limits<std::uint32_t>::digits) {
+                auto const numer = static_cast<std::uint64_t>(high) << static_cast<unsigned>(digits);
+                return {.quotient = static_cast<U>(numer / denom), .remainder = static_cast<U>(numer % denom)};
+        } else if constexpr (digits <= numeric_limits<std::uint64_t>::digits) {
+                auto const numer = static_cast<uint128>(high) << static_cast<unsigned>(digits);
+                return {.quotient = static_cast<U>(numer / denom), .remainder = static_cast<U>(numer % denom)};
+        } else {
+                // Restoring long division, the dividend's low half all zeros: one bit of quotient per step.
+                auto quotient = U{0};
+                auto rest = high;
+                for (auto bit = 0; bit != digits; ++bit) {
+                        auto const carry = static_cast<U>(rest >> static_cast<std::size_t>(digits - 1)) != U{0};
+                        rest = static_cast<U>(rest << std::size_t{1});
+                        quotient = static_cast<U>(quotient << std::size_t{1});
+                        if (carry or rest >= denom) {
+                                rest = static_cast<U>(rest - denom);
+                                quotient = static_cast<U>(quotient | U{1});
+                        }
+                }
+                return {.quotient = quotient, .remainder = rest};
+        }
+}
+
+} // namespace detail
+
+// A denominator fixed at run time, its reciprocal computed once: then every division is a multiplication and shifts.
+template<integer I>
+class divider
+{
+        using U = make_unsigned_t<I>;
+
+        I denom;
+        U magic = U{0}; // zero for a power of two, which is a shift alone
+        int shift = 0;
+        bool add = false; // the reciprocal needs digits + 1 bits: its top bit is added back in
+
+public:
+        // libdivide's round-up method: m = 2^(digits + l) / |d| + 1 with l = floor(log2(|d|)), or twice that when it
+        // is not exact enough, in which case the quotient is recovered by one more add and shift.
+        [[nodiscard]] constexpr explicit divider(I d) noexcept(nothrow_const_operators<I>)
+        :       denom(d)
+        {
+                XSTD_PRECONDITION(d != static_cast<I>(0));
+                auto const magnitude = xstd::unsigned_abs(d);
+                auto const log2 = xstd::bit_width(magnitude) - 1;
+                shift = log2;
+                if (static_cast<U>(magnitude & static_cast<U>(magnitude - U{1})) == U{0}) {
+                        return;
+                }
+                auto const power = static_cast<U>(U{1} << static_cast<std::size_t>(log2));
+                auto [proposed, remainder] = detail::div_wide(power, magnitude);
+                if (static_cast<U>(magnitude - remainder) >= power) {
+                        proposed = static_cast<U>(proposed + proposed);
+                        auto const twice = static_cast<U>(remainder + remainder);
+                        if (twice >= magnitude or twice < remainder) {
+                                proposed = static_cast<U>(proposed + U{1});
+                        }
+                        add = true;
+                }
+                magic = static_cast<U>(proposed + U{1});
+        }
+
+        [[nodiscard]] constexpr auto denominator() const noexcept
+                -> I
+        {
+                return denom;
+        }
+
+        // floor(log2(|d|)): for a power of two, the whole division.
+        [[nodiscard]] constexpr auto shift_count() const noexcept
+                -> int
+        {
+                return shift;
+        }
+
+        // floor(n / |d|) for the magnitude n: a multiply-high and a shift.
+        [[nodiscard]] constexpr auto quotient(U n) const noexcept(nothrow_const_operators<I>)
+                -> U
+        {
+                if (magic == U{0}) {
+                        return static_cast<U>(n >> static_cast<std::size_t>(shift));
+                }
+                auto const q = detail::mul_high(magic, n);
+                if (add) {
+                        // (n - q) / 2 + q is the digits + 1 bit sum, halved, that cannot overflow.
+                        auto const t = static_cast<U>(static_cast<U>(static_cast<U>(n - q) >> std::size_t{1}) + q);
+                        return static_cast<U>(t >> static_cast<std::size_t>(shift));
+                }
+                return static_cast<U>(q >> static_cast<std::size_t>(shift));
+        }
+};
+
+// Truncated division by a divider: the magnitudes divided, then the signs applied as [expr.mul] has them.
+template<integer I>
+[[nodiscard]] constexpr auto div(I numer, divider<I> const& denom) noexcept(nothrow_const_operators<I>)
+        -> div_result<I>
+{
+        using U = make_unsigned_t<I>;
+        auto const d = denom.denominator();
+        if constexpr (is_signed_v<I>) {
+                XSTD_PRECONDITION(numer != numeric_limits<I>::min() or d != static_cast<I>(-1));
+        }
+        // Products of magnitudes never exceed the numerator's, so neither wraps nor, promoted, overflows.
+        auto const n = xstd::unsigned_abs(numer);
+        auto q = denom.quotient(n);
+        auto r = static_cast<U>(n - static_cast<U>(q * xstd::unsigned_abs(d)));
+        if constexpr (is_signed_v<I>) {
+                auto const zero = static_cast<U>(0);
+                if ((numer < static_cast<I>(0)) != (d < static_cast<I>(0))) {
+                        q = static_cast<U>(zero - q);
+                }
+                if (numer < static_cast<I>(0)) {
+                        r = static_cast<U>(zero - r);
+                }
+        }
+        auto const qT = static_cast<I>(q);
+        auto const rT = static_cast<I>(r);
+        XSTD_AUDIT(numer == static_cast<I>(static_cast<I>(d * qT) + rT));
+        XSTD_AUDIT(xstd::unsigned_abs(rT) < xstd::unsigned_abs(d));
+        return {.quotient = qT, .remainder = rT};
+}
+
+template<integer I>
+[[nodiscard]] constexpr auto div_floor(I numer, divider<I> const& denom) noexcept(nothrow_const_operators<I>)
+        -> div_result<I>
+{
+        return detail::floor_from_truncated(xstd::div(numer, denom), denom.denominator());
+}
+
+template<integer I>
+[[nodiscard]] constexpr auto div_euclid(I numer, divider<I> const& denom) noexcept(nothrow_const_operators<I>)
+        -> div_result<I>
+{
+        return detail::euclid_from_truncated(xstd::div(numer, denom), denom.denominator());
+}
+
+namespace detail {
+
+// Built during constant evaluation, once per type and denominator: the reciprocal is a literal in the code.
+template<integer I, auto D>
+inline constexpr auto constant_divider = divider<I>(static_cast<I>(D));
+
+// A positive power of two, for which the floored and Euclidean results are a shift and a mask.
+template<integer I, auto D>
+inline constexpr bool is_positive_power_of_two = static_cast<I>(D) > static_cast<I>(0) and (static_cast<I>(D) & static_cast<I>(static_cast<I>(D) - static_cast<I>(1))) == static_cast<I>(0);
+
+template<integer I, auto D>
+consteval auto check_constant_denominator() noexcept
+        -> void
+{
+        static_assert(static_cast<I>(D) != static_cast<I>(0));
+        if constexpr (std::integral<decltype(D)>) {
+                static_assert(static_cast<decltype(D)>(static_cast<I>(D)) == D, "the denominator does not fit in the numerator's type");
+        }
+        // The round trip above takes -1 to max() and back: a negative denominator has to be refused by its sign.
+        if constexpr (not is_signed_v<I> and is_signed_v<decltype(D)>) {
+                static_assert(not (D < static_cast<decltype(D)>(0)), "a negative denominator for an unsigned numerator");
+        }
+}
+
+// The arithmetic shift that a signed >> is, on the unsigned counterpart: the vacated bits filled with the sign.
+template<integer I>
+[[nodiscard]] constexpr auto div_floor_power_of_two(I numer, int shift) noexcept(nothrow_const_operators<I>)
+        -> div_result<I>
+{
+        using U = make_unsigned_t<I>;
+        auto const bits = static_cast<std::size_t>(shift);
+        auto const u = static_cast<U>(numer);
+        auto const mask = static_cast<U>(static_cast<U>(U{1} << bits) - U{1});
+        auto q = static_cast<U>(u >> bits);
+        if constexpr (is_signed_v<I>) {
+                if (numer < static_cast<I>(0)) {
+                        q = static_cast<U>(q | static_cast<U>(~static_cast<U>(static_cast<U>(~U{0}) >> bits)));
+                }
+        }
+        return {.quotient = static_cast<I>(q), .remainder = static_cast<I>(static_cast<U>(u & mask))};
+}
+
+} // namespace detail
+
+// Truncated division by a constant: div<10>(x), the reciprocal computed by the compiler, also for integer-class types.
+template<auto D, integer I>
+[[nodiscard]] constexpr auto div(I numer) noexcept(nothrow_const_operators<I>)
+        -> div_result<I>
+{
+        detail::check_constant_denominator<I, D>();
+        return xstd::div(numer, detail::constant_divider<I, D>);
+}
+
+template<auto D, integer I>
+[[nodiscard]] constexpr auto div_floor(I numer) noexcept(nothrow_const_operators<I>)
+        -> div_result<I>
+{
+        detail::check_constant_denominator<I, D>();
+        if constexpr (detail::is_positive_power_of_two<I, D>) {
+                return detail::div_floor_power_of_two(numer, detail::constant_divider<I, D>.shift_count());
+        } else {
+                return detail::floor_from_truncated(xstd::div<D>(numer), static_cast<I>(D));
+        }
+}
+
+// A positive denominator makes floored and Euclidean division the same, so only a negative one differs.
+template<auto D, integer I>
+[[nodiscard]] constexpr auto div_euclid(I numer) noexcept(nothrow_const_operators<I>)
+        -> div_result<I>
+{
+        detail::check_constant_denominator<I, D>();
+        if constexpr (static_cast<I>(D) > static_cast<I>(0)) {
+                return xstd::div_floor<D>(numer);
+        } else {
+                return detail::euclid_from_truncated(xstd::div<D>(numer), static_cast<I>(D));
+        }
+}
+
+} // namespace xstd
+
+#endif // XSTD_CSTDLIB_DIVIDER_HPP
@@ -0,0 +1,70 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef XSTD_CSTDLIB_REM_EUCLID_HPP
+#define XSTD_CSTDLIB_REM_EUCLID_HPP
+
+#include <xstd/concepts/integer.hpp>                 // integer
+#include <xstd/concepts/nothrow_const_operators.hpp> // nothrow_const_operators
+#include <xstd/contracts.hpp>                        // XSTD_AUDIT, XSTD_PRECONDITION
+#include <xstd/cstdlib/div.hpp>                      // detail::rem_truncated
+#include <xstd/cstdlib/divider.hpp>                  // div, detail::check_constant_denominator
+#include <xstd/cstdlib/rem_floor.hpp>                // rem_floor
+#include <xstd/cstdlib/sign.hpp>                     // sign
+#include <xstd/cstdlib/unsigned_abs.hpp>             // unsigned_abs
+#include <xstd/limits/numeric_limits.hpp>            // numeric_limits
+#include <xstd/type_traits/is_signed.hpp>            // is_signed_v
+
+namespace xstd {
+
+namespace detail {
+
+// A truncated remainder moved to the Euclidean one: what euclid_from_truncated does, less the quotient.
+template<integer I>
+[[nodiscard]] constexpr auto rem_euclid_from_truncated(I rT, I denom) noexcept(nothrow_const_operators<I>)
+        -> I
+{
+        if constexpr (is_signed_v<I>) {
+                auto const zero = static_cast<I>(0);
+                auto const rE = rT < zero ? (denom > zero ? static_cast<I>(rT + denom) : static_cast<I>(rT - denom)) : rT;
+                // Said on the counterpart every integer type has, |MIN| fitting in no other.
+                XSTD_AUDIT(xstd::unsigned_abs(rE) < xstd::unsigned_abs(denom));
+                XSTD_AUDIT(xstd::sign(rE) >= 0);
+                return rE;
+        } else {
+                return rT;
+        }
+}
+
+} // namespace detail
+
+// The remainder of div_euclid alone: one % and a sign fix-up, no quotient.
+template<integer I>
+[[nodiscard]] constexpr auto rem_euclid(I numer, I denom) noexcept(nothrow_const_operators<I>)
+        -> I
+{
+        XSTD_PRECONDITION(denom != static_cast<I>(0));
+        if constexpr (is_signed_v<I>) {
+                XSTD_PRECONDITION(numer != numeric_limits<I>::min() or denom != static_cast<I>(-1));
+        }
+        return detail::rem_euclid_from_truncated(detail::rem_truncated(numer, denom), denom);
+}
+
+// By a constant: a positive one makes it rem_floor<D>, a mask for a power of two.
+template<auto D, integer I>
+[[nodiscard]] constexpr auto rem_euclid(I numer) noexcept(nothrow_const_operators<I>)
+        -> I
+{
+        detail::check_constant_denominator<I, D>();
+        if constexpr (static_cast<I>(D) > static_cast<I>(0)) {
+                return xstd::rem_floor<D>(numer);
+        } else {
+                return detail::rem_euclid_from_truncated(xstd::div<D>(numer).remainder, static_cast<I>(D));
+        }
+}
+
+} // namespace xstd
+
+#endif // XSTD_CSTDLIB_REM_EUCLID_HPP
@@ -0,0 +1,80 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef XSTD_CSTDLIB_REM_FLOOR_HPP
+#define XSTD_CSTDLIB_REM_FLOOR_HPP
+
+#include <xstd/concepts/integer.hpp>                 // integer
+#include <xstd/concepts/nothrow_const_operators.hpp> // nothrow_const_operators
+#include <xstd/contracts.hpp>                        // XSTD_AUDIT, XSTD_PRECONDITION
+#include <xstd/cstdlib/div.hpp>                      // detail::rem_truncated
+#include <xstd/cstdlib/divider.hpp>                  // div, detail::check_constant_denominator, detail::constant_divider, detail::is_positive_power_of_two
+#include <xstd/cstdlib/sign.hpp>                     // sign
+#include <xstd/cstdlib/unsigned_abs.hpp>             // unsigned_abs
+#include <xstd/limits/numeric_limits.hpp>            // numeric_limits
+#include <xstd/type_traits/is_signed.hpp>            // is_signed_v
+#include <xstd/type_traits/make_unsigned.hpp>        // make_unsigned_t
+#include <cstddef>                                   // size_t
+
+namespace xstd {
+
+namespace detail {
+
+// A truncated remainder moved to the floored one: what floor_from_truncated does, less the quotient.
+template<integer I>
+[[nodiscard]] constexpr auto rem_floor_from_truncated(I rT, I denom) noexcept(nothrow_const_operators<I>)
+        -> I
+{
+        if constexpr (is_signed_v<I>) {
+                auto const rF = xstd::sign(rT) == -xstd::sign(denom) ? static_cast<I>(rT + denom) : rT;
+                // Said on the counterpart every integer type has, |MIN| fitting in no other.
+                XSTD_AUDIT(xstd::unsigned_abs(rF) < xstd::unsigned_abs(denom));
+                XSTD_AUDIT(xstd::sign(rF) == xstd::sign(denom) or rF == static_cast<I>(0));
+                return rF;
+        } else {
+                return rT;
+        }
+}
+
+// The low bits of the two's complement representation: the floored remainder by a positive power of two, 2^shift.
+template<integer I>
+[[nodiscard]] constexpr auto rem_power_of_two(I numer, int shift) noexcept(nothrow_const_operators<I>)
+        -> I
+{
+        using U = make_unsigned_t<I>;
+        auto const mask = static_cast<U>(static_cast<U>(U{1} << static_cast<std::size_t>(shift)) - U{1});
+        return static_cast<I>(static_cast<U>(static_cast<U>(numer) & mask));
+}
+
+} // namespace detail
+
+// The remainder of div_floor alone: one % and a sign fix-up, no quotient.
+template<integer I>
+[[nodiscard]] constexpr auto rem_floor(I numer, I denom) noexcept(nothrow_const_operators<I>)
+        -> I
+{
+        XSTD_PRECONDITION(denom != static_cast<I>(0));
+        if constexpr (is_signed_v<I>) {
+                XSTD_PRECONDITION(numer != numeric_limits<I>::min() or denom != static_cast<I>(-1));
+        }
+        return detail::rem_floor_from_truncated(detail::rem_truncated(numer, denom), denom);
+}
+
+// By a constant: a mask for a positive power of two, otherwise div<D>'s remainder, fixed up.
+template<auto D, integer I>
+[[nodiscard]] constexpr auto rem_floor(I numer) noexcept(nothrow_const_operators<I>)
+        -> I
+{
+        detail::check_constant_denominator<I, D>();
+        if constexpr (detail::is_positive_power_of_two<I, D>) {
+                return detail::rem_power_of_two(numer, detail::constant_divider<I, D>.shift_count());
+        } else {
+                return detail::rem_floor_from_truncated(xstd::div<D>(numer).remainder, static_cast<I>(D));
+        }
+}
+
+} // namespace xstd
+
+#endif // XSTD_CSTDLIB_REM_FLOOR_HPP
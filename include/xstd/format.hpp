@@ -6,6 +6,7 @@
 #ifndef XSTD_FORMAT_HPP
 #define XSTD_FORMAT_HPP
 
-#include <xstd/format/div_result.hpp> // IWYU pragma: export; formatter<div_result>
+#include <xstd/format/div_result.hpp>        // IWYU pragma: export; formatter<div_result>
+#include <xstd/format/formatted_integer.hpp> // IWYU pragma: export; formatted_integer, formatter<formatted_integer>
 
 #endif // XSTD_FORMAT_HPP
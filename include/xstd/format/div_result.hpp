@@ -9,10 +9,10 @@
 #include <xstd/charconv/to_chars.hpp>  // to_chars, to_chars_max_size
 #include <xstd/concepts/integer.hpp>   // integer
 #include <xstd/cstdlib/div_result.hpp> // div_result
+#include <algorithm>                   // copy
 #include <array>                       // array
 #include <cassert>                     // assert
 #include <format>                      // formattable, formatter
-#include <string>                      // basic_string
 #include <string_view>                 // basic_string_view
 #include <system_error>                // errc
 #include <tuple>                       // tie, tuple
@@ -31,32 +31,45 @@ template<xstd::integer I, class CharT>
 // NOLINTNEXTLINE(bugprone-std-namespace-modification): permitted by [namespace.std]/2, see above
 struct std::formatter<xstd::div_result<I>, CharT> : std::formatter<std::basic_string_view<CharT>, CharT>
 {
+        // An empty spec asks for no fill, width or precision, so format() can skip the base altogether.
+        constexpr auto parse(auto& ctx)
+                -> decltype(ctx.begin())
+        {
+                unformatted = ctx.begin() == ctx.end() or *ctx.begin() == static_cast<CharT>('}');
+                return std::formatter<std::basic_string_view<CharT>, CharT>::parse(ctx);
+        }
+
         [[nodiscard]] XSTD_CONSTEXPR_FORMAT auto format(xstd::div_result<I> const& d, auto& ctx) const
                 -> decltype(ctx.out())
         {
-                constexpr auto N = xstd::to_chars_max_size<I>;
-                auto widened = std::basic_string<CharT>{};
-                auto buffer = std::array<char, N>{};
+                // Both members, the separator and the parentheses, on the stack in CharT: sized for base 2, so decimal always fits.
+                constexpr auto N = 2 * xstd::to_chars_max_size<I> + 4;
+                auto buffer = std::array<CharT, N>{};
+                auto* out = buffer.data();
 
                 auto const append = [&](I const value) XSTD_CONSTEXPR_FORMAT -> void {
-                        auto const result = xstd::to_chars(buffer.data(), buffer.data() + N, value);
-                        // The buffer is sized for base 2, so decimal always fits.
+                        auto const result = xstd::to_chars(out, buffer.data() + N, value);
                         assert(result.ec == std::errc{});
-                        for (auto const* p = buffer.data(); p != result.ptr; ++p) {
-                                widened.push_back(static_cast<CharT>(*p));
-                        }
+                        out = result.ptr;
                 };
 
                 // Spelled to match the tuple formatter, so the two render identically.
-                widened.push_back(static_cast<CharT>('('));
+                *out++ = static_cast<CharT>('(');
                 append(d.quotient);
-                widened.push_back(static_cast<CharT>(','));
-                widened.push_back(static_cast<CharT>(' '));
+                *out++ = static_cast<CharT>(',');
+                *out++ = static_cast<CharT>(' ');
                 append(d.remainder);
-                widened.push_back(static_cast<CharT>(')'));
+                *out++ = static_cast<CharT>(')');
 
-                return std::formatter<std::basic_string_view<CharT>, CharT>::format(widened, ctx);
+                auto const text = std::basic_string_view<CharT>(buffer.data(), out);
+                if (unformatted) {
+                        return std::ranges::copy(text, ctx.out()).out;
+                }
+                return std::formatter<std::basic_string_view<CharT>, CharT>::format(text, ctx);
         }
+
+private:
+        bool unformatted = false;
 };
 
 // The more constrained one: asked after the tuple, which covers both ways it can be absent.
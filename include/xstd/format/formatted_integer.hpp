@@ -0,0 +1,222 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef XSTD_FORMAT_FORMATTED_INTEGER_HPP
+#define XSTD_FORMAT_FORMATTED_INTEGER_HPP
+
+#include <xstd/charconv/to_chars.hpp>         // to_chars, to_chars_max_size, detail::unsigned_magnitude
+#include <xstd/concepts/integer.hpp>          // integer
+#include <xstd/type_traits/make_unsigned.hpp> // make_unsigned_t
+#include <algorithm>                          // any_of, copy, fill_n, max, transform
+#include <array>                              // array
+#include <cassert>                            // assert
+#include <concepts>                           // same_as
+#include <format>                             // format_error, formatter
+#include <string_view>                        // string_view
+#include <system_error>                       // errc
+#include <type_traits>                        // make_unsigned_t
+
+// An integer, rendered by std::format under the integer grammar: a formatter xstd may provide, unlike one for the
+// built-in and standard-library 128-bit types, which [namespace.std]/2 does not let a program specialize for.
+
+// The format() below is not constexpr before P3391 (C++29); claiming it anyway is IFNDR.
+#if defined(__cpp_lib_constexpr_format) && __cpp_lib_constexpr_format >= 202511L
+#define XSTD_CONSTEXPR_FORMAT constexpr
+#else
+#define XSTD_CONSTEXPR_FORMAT
+#endif
+
+namespace xstd {
+
+// Wrapped at the call site, std::format("{:#x}", xstd::formatted_integer{x}), for any xstd integer.
+template<integer I>
+struct formatted_integer
+{
+        I value;
+};
+
+} // namespace xstd
+
+// [format.string.std] for integers: fill, align, sign, #, 0, a literal width, and one of b, B, d, o, x, X.
+template<xstd::integer I, class CharT>
+// NOLINTNEXTLINE(bugprone-std-namespace-modification): permitted by [namespace.std]/2, see above
+struct std::formatter<xstd::formatted_integer<I>, CharT>
+{
+        constexpr auto parse(auto& ctx)
+                -> decltype(ctx.begin())
+        {
+                auto it = ctx.begin();
+                auto const end = ctx.end();
+                auto const is_align = [](CharT c) {
+                        return c == static_cast<CharT>('<') or c == static_cast<CharT>('^') or c == static_cast<CharT>('>');
+                };
+
+                // An empty spec ends here: the '}' is no fill, even with an alignment character after it.
+                if (it == end or *it == static_cast<CharT>('}')) {
+                        return it;
+                }
+
+                // A fill is any code point but a brace, and only ever ahead of an alignment.
+                if (auto const size = code_point_size(it, end); size != 0 and end - it > size and is_align(it[size])) {
+                        if (*it == static_cast<CharT>('{') or *it == static_cast<CharT>('}')) {
+                                throw std::format_error("invalid fill character");
+                        }
+                        std::ranges::copy(it, it + size, fill.begin());
+                        fill_size = size;
+                        align = static_cast<char>(it[size]);
+                        it += size + 1;
+                } else if (it != end and is_align(*it)) {
+                        align = static_cast<char>(*it);
+                        ++it;
+                }
+                if (it != end and (*it == static_cast<CharT>('+') or *it == static_cast<CharT>('-') or *it == static_cast<CharT>(' '))) {
+                        sign = static_cast<char>(*it);
+                        ++it;
+                }
+                if (it != end and *it == static_cast<CharT>('#')) {
+                        alternate = true;
+                        ++it;
+                }
+                if (it != end and *it == static_cast<CharT>('0')) {
+                        zero_pad = true;
+                        ++it;
+                }
+                for (; it != end and static_cast<CharT>('0') <= *it and *it <= static_cast<CharT>('9'); ++it) {
+                        // NOLINTNEXTLINE(readability-magic-numbers): a decimal width, digit by digit
+                        width = width * 10 + static_cast<int>(*it - static_cast<CharT>('0'));
+                        if (width > max_width) {
+                                throw std::format_error("width is too large");
+                        }
+                }
+                if (it != end and (*it == static_cast<CharT>('{') or *it == static_cast<CharT>('.') or *it == static_cast<CharT>('L'))) {
+                        throw std::format_error("nested width, precision and L are not supported for xstd::formatted_integer");
+                }
+                if (it != end and *it != static_cast<CharT>('}')) {
+                        // Compared as CharT, so that no wide code unit narrows onto one of them.
+                        constexpr auto types = std::string_view("bBdoxX");
+                        if (not std::ranges::any_of(types, [c = *it](char t) { return c == static_cast<CharT>(t); })) {
+                                throw std::format_error("invalid type for an integer");
+                        }
+                        type = static_cast<char>(*it);
+                        ++it;
+                }
+                if (it != end and *it != static_cast<CharT>('}')) {
+                        throw std::format_error("invalid format spec for an integer");
+                }
+                return it;
+        }
+
+        [[nodiscard]] XSTD_CONSTEXPR_FORMAT auto format(xstd::formatted_integer<I> const& f, auto& ctx) const
+                -> decltype(ctx.out())
+        {
+                // The digits of the magnitude, which the unsigned counterpart holds even for min(), on the stack.
+                using U = xstd::make_unsigned_t<I>;
+                auto const negative = f.value < static_cast<I>(0);
+                auto const magnitude = xstd::detail::unsigned_magnitude(f.value);
+                auto const base = type == 'b' or type == 'B' ? 2 : type == 'o' ? 8 : type == 'x' or type == 'X' ? 16 : 10;
+                auto digits = std::array<CharT, xstd::to_chars_max_size<U>>{};
+                auto const result = xstd::to_chars(digits.data(), digits.data() + digits.size(), magnitude, base);
+                assert(result.ec == std::errc{});
+                auto const count = static_cast<int>(result.ptr - digits.data());
+
+                // Then what goes ahead of them: a sign if asked for or negative, and a prefix if alternate.
+                auto head = std::array<char, 3>{};
+                auto* head_last = head.data();
+                if (negative) {
+                        *head_last++ = '-';
+                } else if (sign == '+' or sign == ' ') {
+                        *head_last++ = sign;
+                }
+                // A zero is its own octal prefix, as in the standard.
+                if (alternate and base != 10 and not (base == 8 and magnitude == U{0})) {
+                        *head_last++ = '0';
+                        if (base != 8) {
+                                *head_last++ = type;
+                        }
+                }
+                auto const head_count = static_cast<int>(head_last - head.data());
+
+                // Zeros go between the prefix and the digits, and only where no alignment overrides them.
+                auto const padding = std::max(width - head_count - count, 0);
+                auto const zeros = zero_pad and align == '\0' ? padding : 0;
+                auto const fills = padding - zeros;
+                auto const before = align == '<' ? 0 : align == '^' ? fills / 2 : fills;
+
+                // Written in CharT already: only X has letters to upper-case on the way out.
+                auto const widen = [upper = type == 'X'](CharT c) {
+                        return upper and static_cast<CharT>('a') <= c and c <= static_cast<CharT>('f') ? static_cast<CharT>(c - 'a' + 'A') : c;
+                };
+                auto const put_fill = [this](auto it, int n) {
+                        for (; n > 0; --n) {
+                                it = std::ranges::copy(fill.data(), fill.data() + fill_size, it).out;
+                        }
+                        return it;
+                };
+                auto out = put_fill(ctx.out(), before);
+                out = std::ranges::transform(head.data(), head_last, out, [](char c) { return static_cast<CharT>(c); }).out;
+                out = std::ranges::fill_n(out, zeros, static_cast<CharT>('0'));
+                out = std::ranges::transform(digits.data(), result.ptr, out, widen).out;
+                return put_fill(out, fills - before);
+        }
+
+private:
+        // The literal encoding, which [format.string.std] reads a fill in: UTF-8 if a micro sign is C2 B5 in it.
+        static constexpr auto literal_utf8 = []() {
+                constexpr auto micro = std::string_view("\u00B5");
+                return micro.size() == 2 and static_cast<unsigned char>(micro[0]) == 0xC2U and static_cast<unsigned char>(micro[1]) == 0xB5U;
+        }();
+
+        // The code units of the code point at it: one, but for a UTF-8 char or a UTF-16 wchar_t sequence, and none
+        // for a sequence that is broken off or malformed, which then cannot be a fill.
+        static constexpr auto code_point_size(auto it, auto end)
+                -> int
+        {
+                if (it == end) {
+                        return 0;
+                }
+                auto size = 1;
+                auto const lead = static_cast<std::make_unsigned_t<CharT>>(*it);
+                if constexpr (std::same_as<CharT, char>) {
+                        if (literal_utf8 and lead >= 0x80U) {
+                                // NOLINTBEGIN(readability-magic-numbers): the UTF-8 lead and continuation byte patterns
+                                size = (lead & 0xE0U) == 0xC0U ? 2 : (lead & 0xF0U) == 0xE0U ? 3 : (lead & 0xF8U) == 0xF0U ? 4 : 0;
+                                if (end - it < size) {
+                                        return 0;
+                                }
+                                for (auto k = 1; k < size; ++k) {
+                                        if ((static_cast<unsigned char>(it[k]) & 0xC0U) != 0x80U) {
+                                                return 0;
+                                        }
+                                }
+                                // NOLINTEND(readability-magic-numbers)
+                        }
+                } else if constexpr (sizeof(CharT) == 2) {
+                        // NOLINTBEGIN(readability-magic-numbers): the UTF-16 surrogate ranges
+                        if (0xD800U <= lead and lead <= 0xDFFFU) {
+                                auto const high = lead <= 0xDBFFU and end - it >= 2;
+                                auto const trail = high ? static_cast<std::make_unsigned_t<CharT>>(it[1]) : 0U;
+                                size = high and 0xDC00U <= trail and trail <= 0xDFFFU ? 2 : 0;
+                        }
+                        // NOLINTEND(readability-magic-numbers)
+                }
+                return size;
+        }
+
+        // Far beyond any buffer, but well within int, so the padding arithmetic cannot overflow.
+        static constexpr auto max_width = 1'000'000;
+
+        std::array<CharT, 4> fill = {static_cast<CharT>(' ')};
+        int fill_size = 1;
+        char align = '\0';
+        char sign = '-';
+        bool alternate = false;
+        bool zero_pad = false;
+        int width = 0;
+        char type = 'd';
+};
+
+#undef XSTD_CONSTEXPR_FORMAT
+
+#endif // XSTD_FORMAT_FORMATTED_INTEGER_HPP
@@ -0,0 +1,13 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef XSTD_NUMERIC_HPP
+#define XSTD_NUMERIC_HPP
+
+// Modular arithmetic
+#include <xstd/numeric/modulus.hpp> // IWYU pragma: export; modulus
+#include <xstd/numeric/mod_int.hpp> // IWYU pragma: export; mod_int
+
+#endif // XSTD_NUMERIC_HPP
@@ -0,0 +1,280 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef XSTD_NUMERIC_MOD_INT_HPP
+#define XSTD_NUMERIC_MOD_INT_HPP
+
+#include <xstd/charconv/to_chars.hpp>               // detail::to_chars_result_for, to_chars
+#include <xstd/concepts/integer.hpp>                 // integer
+#include <xstd/concepts/nothrow_const_operators.hpp> // nothrow_const_operators
+#include <xstd/concepts/unsigned_integer.hpp>        // unsigned_integer
+#include <xstd/contracts.hpp>                        // XSTD_PRECONDITION
+#include <xstd/cstdlib/div.hpp>                      // div
+#include <xstd/cstdlib/div_exact.hpp>                // detail::mul_wrap
+#include <xstd/cstdlib/div_result.hpp>               // div_result
+#include <xstd/cstdlib/rem_euclid.hpp>               // rem_euclid
+#include <xstd/cstdlib/sign.hpp>                     // sign
+#include <xstd/cstdlib/unsigned_abs.hpp>             // unsigned_abs
+#include <xstd/limits/numeric_limits.hpp>            // numeric_limits
+#include <xstd/numeric/modulus.hpp>                  // modulus
+#include <xstd/type_traits/is_character.hpp>         // is_character_v
+#include <xstd/type_traits/is_signed.hpp>            // is_signed_v
+#include <compare>                                   // strong_ordering
+#include <concepts>                                  // integral, same_as
+
+namespace xstd {
+
+namespace detail {
+
+// A modulus known at compile time, its reciprocal and Montgomery constants computed there as well.
+template<unsigned_integer U, U M>
+inline constexpr auto constant_modulus = modulus<U>(M);
+
+} // namespace detail
+
+// The integers modulo M, M at least 2, held as the residue in [0, M): +, - and * wrap around M as those of an unsigned
+// type wrap around 2^digits, by a conditional subtraction or by multiply-shift constants fixed at compile time; / and
+// % divide the residues, which no wrap-around can reach. Not an integer-class type, which wraps around a power of two
+// that the kernels written for integer build their constants on: div, sign and to_chars are overloaded for it below.
+template<unsigned_integer I, I M>
+class mod_int
+{
+        static_assert(M > I{1}, "a modulus of 0 or 1 leaves nothing to reduce");
+
+        static constexpr auto last = static_cast<I>(M - I{1});
+
+        // A sum of two residues overflows I only if M is more than half of its range.
+        static constexpr auto sum_fits = last <= static_cast<I>(numeric_limits<I>::max() - last);
+
+        // And a product only if M is more than its square root.
+        static constexpr auto product_fits = last <= static_cast<I>(numeric_limits<I>::max() / last);
+
+        I value = I{0};
+
+        struct reduced_t
+        {};
+
+        constexpr mod_int(reduced_t, I residue) noexcept
+        :       value(residue)
+        {}
+
+        [[nodiscard]] static constexpr auto from_residue(I residue) noexcept
+                -> mod_int
+        {
+                return {reduced_t{}, residue};
+        }
+
+        // Any unsigned value, its type wider than I or not, by the reciprocal of M in the wider of the two.
+        template<unsigned_integer J>
+        [[nodiscard]] static constexpr auto reduce(J x) noexcept(nothrow_const_operators<I> and nothrow_const_operators<J>)
+                -> I
+        {
+                if constexpr (numeric_limits<J>::digits <= numeric_limits<I>::digits) {
+                        return xstd::rem_euclid<M>(static_cast<I>(x));
+                } else {
+                        return static_cast<I>(xstd::rem_euclid<static_cast<J>(M)>(x));
+                }
+        }
+
+        // A sum of residues less than 2 M, or less than M after its carry out of I: one subtraction at most.
+        [[nodiscard]] static constexpr auto subtract_once(I sum, bool carry) noexcept(nothrow_const_operators<I>)
+                -> I
+        {
+                return carry or sum > last ? static_cast<I>(sum - M) : sum;
+        }
+
+public:
+        mod_int() = default;
+
+        // Any integer, negative ones to the residue they are congruent to: -1 is M - 1.
+        template<class J>
+                requires (std::integral<J> or std::same_as<J, I>) and integer<J>
+        constexpr mod_int(J x) noexcept(nothrow_const_operators<I> and nothrow_const_operators<J>) // NOLINT(google-explicit-constructor): /6 asks for implicit conversions in
+        :       value(reduce(xstd::unsigned_abs(x)))
+        {
+                if constexpr (is_signed_v<J>) {
+                        if (x < static_cast<J>(0) and value != I{0}) {
+                                value = static_cast<I>(M - value);
+                        }
+                }
+        }
+
+        template<class J>
+                requires (std::integral<J> or std::same_as<J, I>) and integer<J>
+        [[nodiscard]] constexpr explicit operator J() const noexcept(nothrow_const_operators<I>)
+        {
+                return static_cast<J>(value);
+        }
+
+        [[nodiscard]] constexpr explicit operator bool() const noexcept(nothrow_const_operators<I>)
+        {
+                return value != I{0};
+        }
+
+        [[nodiscard]] constexpr auto residue() const noexcept
+                -> I
+        {
+                return value;
+        }
+
+        [[nodiscard]] friend constexpr auto operator==(mod_int, mod_int) noexcept(nothrow_const_operators<I>) -> bool = default;
+        [[nodiscard]] friend constexpr auto operator<=>(mod_int, mod_int) noexcept(nothrow_const_operators<I>) -> std::strong_ordering = default;
+
+        constexpr auto operator++() noexcept(nothrow_const_operators<I>)
+                -> mod_int&
+        {
+                value = value == last ? I{0} : static_cast<I>(value + I{1});
+                return *this;
+        }
+
+        constexpr auto operator--() noexcept(nothrow_const_operators<I>)
+                -> mod_int&
+        {
+                value = value == I{0} ? last : static_cast<I>(value - I{1});
+                return *this;
+        }
+
+        constexpr auto operator++(int) noexcept(nothrow_const_operators<I>)
+                -> mod_int
+        {
+                auto const old = *this;
+                ++*this;
+                return old;
+        }
+
+        constexpr auto operator--(int) noexcept(nothrow_const_operators<I>)
+                -> mod_int
+        {
+                auto const old = *this;
+                --*this;
+                return old;
+        }
+
+        [[nodiscard]] constexpr auto operator+() const noexcept
+                -> mod_int
+        {
+                return *this;
+        }
+
+        [[nodiscard]] constexpr auto operator-() const noexcept(nothrow_const_operators<I>)
+                -> mod_int
+        {
+                return from_residue(value == I{0} ? I{0} : static_cast<I>(M - value));
+        }
+
+        [[nodiscard]] constexpr auto operator not() const noexcept(nothrow_const_operators<I>)
+                -> bool
+        {
+                return value == I{0};
+        }
+
+        constexpr auto operator+=(mod_int other) noexcept(nothrow_const_operators<I>)
+                -> mod_int&
+        {
+                auto const sum = static_cast<I>(value + other.value);
+                if constexpr (sum_fits) {
+                        value = subtract_once(sum, false);
+                } else {
+                        value = subtract_once(sum, sum < value);
+                }
+                return *this;
+        }
+
+        constexpr auto operator-=(mod_int other) noexcept(nothrow_const_operators<I>)
+                -> mod_int&
+        {
+                auto const difference = static_cast<I>(value - other.value);
+                value = value < other.value ? static_cast<I>(difference + M) : difference;
+                return *this;
+        }
+
+        constexpr auto operator*=(mod_int other) noexcept(nothrow_const_operators<I>)
+                -> mod_int&
+        {
+                if constexpr (product_fits) {
+                        value = xstd::rem_euclid<M>(detail::mul_wrap(value, other.value));
+                } else {
+                        value = detail::constant_modulus<I, M>.mul_mod(value, other.value);
+                }
+                return *this;
+        }
+
+        constexpr auto operator/=(mod_int other) noexcept(nothrow_const_operators<I>)
+                -> mod_int&
+        {
+                XSTD_PRECONDITION(other.value != I{0});
+                value = static_cast<I>(value / other.value);
+                return *this;
+        }
+
+        constexpr auto operator%=(mod_int other) noexcept(nothrow_const_operators<I>)
+                -> mod_int&
+        {
+                XSTD_PRECONDITION(other.value != I{0});
+                value = static_cast<I>(value % other.value);
+                return *this;
+        }
+
+        [[nodiscard]] friend constexpr auto operator*(mod_int lhs, mod_int rhs) noexcept(nothrow_const_operators<I>)
+                -> mod_int
+        {
+                return lhs *= rhs;
+        }
+
+        [[nodiscard]] friend constexpr auto operator/(mod_int lhs, mod_int rhs) noexcept(nothrow_const_operators<I>)
+                -> mod_int
+        {
+                return lhs /= rhs;
+        }
+
+        [[nodiscard]] friend constexpr auto operator%(mod_int lhs, mod_int rhs) noexcept(nothrow_const_operators<I>)
+                -> mod_int
+        {
+                return lhs %= rhs;
+        }
+
+        [[nodiscard]] friend constexpr auto operator+(mod_int lhs, mod_int rhs) noexcept(nothrow_const_operators<I>)
+                -> mod_int
+        {
+                return lhs += rhs;
+        }
+
+        [[nodiscard]] friend constexpr auto operator-(mod_int lhs, mod_int rhs) noexcept(nothrow_const_operators<I>)
+                -> mod_int
+        {
+                return lhs -= rhs;
+        }
+
+};
+
+// Truncated division of the residues, quotient and remainder in I: the two are residues themselves.
+template<unsigned_integer I, I M>
+[[nodiscard]] constexpr auto div(mod_int<I, M> x, mod_int<I, M> y) noexcept(nothrow_const_operators<I>)
+        -> div_result<I>
+{
+        return xstd::div(x.residue(), y.residue());
+}
+
+// 0 or 1, as for any unsigned type.
+template<unsigned_integer I, I M>
+[[nodiscard]] constexpr auto sign(mod_int<I, M> x) noexcept(nothrow_const_operators<I>)
+        -> int
+{
+        return xstd::sign(x.residue());
+}
+
+// The residue's digits, so that to_chars_max_size<I> is room enough for any of them.
+template<class CharT, unsigned_integer I, I M>
+        requires is_character_v<CharT>
+// NOLINTNEXTLINE(readability-magic-numbers): the standard's own default base, see to_chars
+[[nodiscard]] constexpr auto to_chars(CharT* first, CharT* last, mod_int<I, M> x, int base = 10)
+        -> detail::to_chars_result_for<CharT>
+{
+        return xstd::to_chars(first, last, x.residue(), base);
+}
+
+} // namespace xstd
+
+#endif // XSTD_NUMERIC_MOD_INT_HPP
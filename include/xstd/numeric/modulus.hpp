@@ -0,0 +1,182 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef XSTD_NUMERIC_MODULUS_HPP
+#define XSTD_NUMERIC_MODULUS_HPP
+
+#include <xstd/bit.hpp>                              // bit_width
+#include <xstd/concepts/nothrow_const_operators.hpp> // nothrow_const_operators
+#include <xstd/concepts/unsigned_integer.hpp>        // unsigned_integer
+#include <xstd/contracts.hpp>                        // XSTD_AUDIT, XSTD_PRECONDITION
+#include <xstd/cstdlib/div_exact.hpp>                // detail::inverse_odd, detail::mul_wrap
+#include <xstd/cstdlib/divider.hpp>                  // detail::div_wide, detail::mul_high
+#include <xstd/limits/numeric_limits.hpp>            // numeric_limits
+#include <cstddef>                                   // size_t
+
+namespace xstd {
+
+// A modulus fixed at run time, with what reducing by it takes computed once: a normalized reciprocal for any modulus,
+// and for an odd one the inverse and R^2 mod m of Montgomery's method, R being 2^digits. After that, no operation
+// divides.
+template<unsigned_integer U>
+class modulus
+{
+        U mod;
+        U norm = U{0};       // mod shifted up until its top bit is set
+        U reciprocal = U{0}; // floor((R^2 - 1) / norm) - R
+        int shift = 0;       // how far up norm is shifted
+        U inverse = U{0};    // mod^-1 modulo R, for an odd mod
+        U r_squared = U{0};  // R^2 mod mod, for an odd mod
+
+        // (high * R + low) mod norm, for high < norm: Moller and Granlund's division by a normalized reciprocal, its
+        // quotient estimate off by at most one either way and corrected by the two comparisons.
+        [[nodiscard]] constexpr auto rem_normalized(U high, U low) const noexcept(nothrow_const_operators<U>)
+                -> U
+        {
+                XSTD_AUDIT(high < norm);
+                auto const product_low = detail::mul_wrap(reciprocal, high);
+                auto const estimate_low = static_cast<U>(product_low + low);
+                auto const carry = static_cast<U>(estimate_low < product_low ? U{1} : U{0});
+                auto const estimate = static_cast<U>(detail::mul_high(reciprocal, high) + high + U{1} + carry);
+                auto rest = static_cast<U>(low - detail::mul_wrap(estimate, norm));
+                if (rest > estimate_low) {
+                        rest = static_cast<U>(rest + norm);
+                }
+                if (rest >= norm) {
+                        rest = static_cast<U>(rest - norm);
+                }
+                return rest;
+        }
+
+        // (high * R + low) mod mod, for high < mod: both halves shifted up by as much as mod was.
+        [[nodiscard]] constexpr auto rem_wide(U high, U low) const noexcept(nothrow_const_operators<U>)
+                -> U
+        {
+                XSTD_AUDIT(high < mod);
+                if (shift == 0) {
+                        return rem_normalized(high, low);
+                }
+                auto const up = static_cast<std::size_t>(shift);
+                auto const down = static_cast<std::size_t>(numeric_limits<U>::digits - shift);
+                auto const shifted_high = static_cast<U>(static_cast<U>(high << up) | static_cast<U>(low >> down));
+                return static_cast<U>(rem_normalized(shifted_high, static_cast<U>(low << up)) >> up);
+        }
+
+        // Montgomery's REDC of high * R + low, for high < mod: q * mod matches the low half, so subtracting it leaves
+        // its high half to subtract from ours, and mod to add back when that borrows.
+        [[nodiscard]] constexpr auto redc(U high, U low) const noexcept(nothrow_const_operators<U>)
+                -> U
+        {
+                XSTD_AUDIT(high < mod);
+                auto const q = detail::mul_wrap(low, inverse);
+                auto const subtrahend = detail::mul_high(q, mod);
+                auto const rest = static_cast<U>(high - subtrahend);
+                return high < subtrahend ? static_cast<U>(rest + mod) : rest;
+        }
+
+public:
+        [[nodiscard]] constexpr explicit modulus(U m) noexcept(nothrow_const_operators<U>)
+        :       mod(m)
+        {
+                XSTD_PRECONDITION(m != U{0});
+                shift = numeric_limits<U>::digits - xstd::bit_width(m);
+                norm = static_cast<U>(m << static_cast<std::size_t>(shift));
+                // (R - 1 - norm) * R + (R - 1), over norm: the first term by div_wide, the second, less than 2 norm,
+                // adding 1 or 2 to its quotient, by its remainder and R - 1 - norm, which together are less than R.
+                auto const complement = static_cast<U>(~norm);
+                auto const [quotient, remainder] = detail::div_wide(complement, norm);
+                auto const extra = static_cast<U>(static_cast<U>(remainder + complement) >= norm ? U{2} : U{1});
+                reciprocal = static_cast<U>(quotient + extra);
+                if (static_cast<U>(m & U{1}) != U{0}) {
+                        inverse = detail::inverse_odd(m);
+                        auto const r = m == U{1} ? U{0} : rem_wide(U{1}, U{0});
+                        r_squared = mul_mod(r, r);
+                }
+        }
+
+        [[nodiscard]] constexpr auto value() const noexcept
+                -> U
+        {
+                return mod;
+        }
+
+        // x mod m, for any x.
+        [[nodiscard]] constexpr auto reduce(U x) const noexcept(nothrow_const_operators<U>)
+                -> U
+        {
+                return rem_wide(U{0}, x);
+        }
+
+        // The operations on residues, each operand less than m.
+        [[nodiscard]] constexpr auto add_mod(U a, U b) const noexcept(nothrow_const_operators<U>)
+                -> U
+        {
+                XSTD_PRECONDITION(a < mod and b < mod);
+                auto const sum = static_cast<U>(a + b);
+                return sum < a or sum >= mod ? static_cast<U>(sum - mod) : sum;
+        }
+
+        [[nodiscard]] constexpr auto sub_mod(U a, U b) const noexcept(nothrow_const_operators<U>)
+                -> U
+        {
+                XSTD_PRECONDITION(a < mod and b < mod);
+                auto const difference = static_cast<U>(a - b);
+                return a < b ? static_cast<U>(difference + mod) : difference;
+        }
+
+        [[nodiscard]] constexpr auto mul_mod(U a, U b) const noexcept(nothrow_const_operators<U>)
+                -> U
+        {
+                XSTD_PRECONDITION(a < mod and b < mod);
+                return rem_wide(detail::mul_high(a, b), detail::mul_wrap(a, b));
+        }
+
+        // base^exponent mod m by squaring, for any base: in Montgomery form when m is odd, where a step reduces for less.
+        template<unsigned_integer E>
+        [[nodiscard]] constexpr auto pow_mod(U base, E exponent) const noexcept(nothrow_const_operators<U> and nothrow_const_operators<E>)
+                -> U
+        {
+                auto const odd = static_cast<U>(mod & U{1}) != U{0};
+                auto power = odd ? to_montgomery(reduce(base)) : reduce(base);
+                auto result = odd ? to_montgomery(reduce(U{1})) : reduce(U{1});
+                auto const multiply = [&](U a, U b) {
+                        return odd ? montgomery_mul(a, b) : mul_mod(a, b);
+                };
+                for (; exponent != E{0}; exponent = static_cast<E>(exponent >> std::size_t{1})) {
+                        if (static_cast<E>(exponent & E{1}) != E{0}) {
+                                result = multiply(result, power);
+                        }
+                        power = multiply(power, power);
+                }
+                return odd ? from_montgomery(result) : result;
+        }
+
+        // Montgomery form, for an odd m: x R mod m, in which a product reduces by REDC alone.
+        [[nodiscard]] constexpr auto to_montgomery(U x) const noexcept(nothrow_const_operators<U>)
+                -> U
+        {
+                return montgomery_mul(x, r_squared);
+        }
+
+        [[nodiscard]] constexpr auto from_montgomery(U x) const noexcept(nothrow_const_operators<U>)
+                -> U
+        {
+                XSTD_PRECONDITION(static_cast<U>(mod & U{1}) != U{0});
+                XSTD_PRECONDITION(x < mod);
+                return redc(U{0}, x);
+        }
+
+        [[nodiscard]] constexpr auto montgomery_mul(U a, U b) const noexcept(nothrow_const_operators<U>)
+                -> U
+        {
+                XSTD_PRECONDITION(static_cast<U>(mod & U{1}) != U{0});
+                XSTD_PRECONDITION(a < mod and b < mod);
+                return redc(detail::mul_high(a, b), detail::mul_wrap(a, b));
+        }
+};
+
+} // namespace xstd
+
+#endif // XSTD_NUMERIC_MODULUS_HPP
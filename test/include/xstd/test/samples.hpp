@@ -0,0 +1,51 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef XSTD_TEST_SAMPLES_HPP
+#define XSTD_TEST_SAMPLES_HPP
+
+#include <xstd/limits.hpp>                // numeric_limits
+#include <xstd/type_traits/is_signed.hpp> // is_signed_v
+#include <algorithm>                      // sort, unique
+#include <cstddef>                        // size_t
+#include <vector>                         // vector
+
+namespace xstd::test {
+
+// The values a division or a modulus goes wrong on first: the edges, the small values, every power of two with its
+// neighbours and its multiple by three, and both signs of each. Sorted and without repeats, so that a case looping
+// over all pairs of them pays for each pair once.
+template<class T>
+[[nodiscard]] auto samples()
+        -> std::vector<T>
+{
+        using limits = xstd::numeric_limits<T>;
+        auto values = std::vector<T>{
+                limits::min(), limits::max(), static_cast<T>(limits::max() - T{1}),
+                static_cast<T>(limits::max() / T{3}), static_cast<T>(limits::max() / T{7}), static_cast<T>(limits::max() / T{10})
+        };
+        for (auto i = 0; i != 25; ++i) {
+                values.push_back(static_cast<T>(i));
+        }
+        for (auto bit = std::size_t{1}; bit != static_cast<std::size_t>(limits::digits); ++bit) {
+                auto const power = static_cast<T>(T{1} << bit);
+                values.push_back(static_cast<T>(power - T{1}));
+                values.push_back(power);
+                values.push_back(static_cast<T>(power + T{1}));
+                values.push_back(static_cast<T>(T{3} << (bit - 1)));
+        }
+        if constexpr (xstd::is_signed_v<T>) {
+                for (auto const v : std::vector<T>(values)) {
+                        values.push_back(static_cast<T>(T{0} - static_cast<T>(v == limits::min() ? limits::max() : v)));
+                }
+        }
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        return values;
+}
+
+} // namespace xstd::test
+
+#endif // XSTD_TEST_SAMPLES_HPP
@@ -0,0 +1,51 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit.hpp>                             // bit_width, countr_zero
+#include <xstd/test/boost_test_print_log_value.hpp> // NOLINT(misc-include-cleaner): registers Boost.Test printers
+#include <xstd/test/constexpr_check.hpp>            // XSTD_CONSTEXPR_CHECK_EQUAL
+#include <xstd/test/exact_width_types.hpp>          // exact_width_unsigned_integer_types
+#include <xstd/limits.hpp>                          // numeric_limits
+#include <boost/test/unit_test.hpp>                 // BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_CHECK_EQUAL
+#include <concepts>                                 // same_as
+#include <cstddef>                                  // size_t
+
+BOOST_AUTO_TEST_SUITE(Bit)
+
+// Zero, the extremes, and either side of every power of two, chunk boundaries included.
+BOOST_AUTO_TEST_CASE_TEMPLATE(BitWidth, T, xstd::test::exact_width_unsigned_integer_types)
+{
+        static_assert(std::same_as<decltype(xstd::bit_width(T{})), int>);
+
+        using limits = xstd::numeric_limits<T>;
+        XSTD_CONSTEXPR_CHECK_EQUAL(xstd::bit_width(T{0}), 0);
+        XSTD_CONSTEXPR_CHECK_EQUAL(xstd::bit_width(T{1}), 1);
+        XSTD_CONSTEXPR_CHECK_EQUAL(xstd::bit_width(limits::max()), limits::digits);
+
+        for (auto bit = std::size_t{0}; bit < static_cast<std::size_t>(limits::digits); ++bit) {
+                auto const power = static_cast<T>(T{1} << bit);
+                BOOST_CHECK_EQUAL(xstd::bit_width(power), static_cast<int>(bit) + 1);
+                BOOST_CHECK_EQUAL(xstd::bit_width(static_cast<T>(power - T{1})), static_cast<int>(bit));
+                BOOST_CHECK_EQUAL(xstd::bit_width(static_cast<T>(limits::max() >> bit)), limits::digits - static_cast<int>(bit));
+        }
+}
+
+// Zero, and every single bit alone and with all the bits above it set.
+BOOST_AUTO_TEST_CASE_TEMPLATE(CountrZero, T, xstd::test::exact_width_unsigned_integer_types)
+{
+        static_assert(std::same_as<decltype(xstd::countr_zero(T{})), int>);
+
+        using limits = xstd::numeric_limits<T>;
+        XSTD_CONSTEXPR_CHECK_EQUAL(xstd::countr_zero(T{0}), limits::digits);
+        XSTD_CONSTEXPR_CHECK_EQUAL(xstd::countr_zero(T{1}), 0);
+        XSTD_CONSTEXPR_CHECK_EQUAL(xstd::countr_zero(limits::max()), 0);
+
+        for (auto bit = std::size_t{0}; bit < static_cast<std::size_t>(limits::digits); ++bit) {
+                BOOST_CHECK_EQUAL(xstd::countr_zero(static_cast<T>(T{1} << bit)), static_cast<int>(bit));
+                BOOST_CHECK_EQUAL(xstd::countr_zero(static_cast<T>(limits::max() << bit)), static_cast<int>(bit));
+        }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,270 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/charconv/from_chars.hpp>             // from_chars
+#include <xstd/charconv/to_chars.hpp>               // to_chars, to_chars_max_size
+#include <xstd/cstdint.hpp>                         // int128, uint128
+#include <xstd/test/bit_precise.hpp>                // XSTD_TEST_HAS_BIT_PRECISE, XSTD_TEST_BIT_PRECISE_MAX, bit_int, bit_uint
+#include <xstd/test/boost_test_print_log_value.hpp> // NOLINT(misc-include-cleaner): registers Boost.Test printers
+#include <xstd/test/exact_width_types.hpp>          // constexpr_exact_width_signed_integer_types, constexpr_exact_width_unsigned_integer_types, exact_width_signed_integer_types, exact_width_unsigned_integer_types
+#include <xstd/limits.hpp>                          // numeric_limits
+#include <boost/test/unit_test.hpp>                 // BOOST_AUTO_TEST_CASE, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_CHECK, BOOST_CHECK_EQUAL
+#include <array>                                    // array
+#include <cstddef>                                  // size_t
+#include <string>                                   // string
+#include <string_view>                              // string_view
+#include <system_error>                             // errc
+
+BOOST_AUTO_TEST_SUITE(CharConvFromChars)
+
+// Pins that exactly one overload is viable, with bool left out as the standard leaves it.
+template<class T>
+concept has_xstd_from_chars = requires (char const* p, T& value) { xstd::from_chars(p, p, value, 10); };
+
+BOOST_AUTO_TEST_CASE(DomainMatchesToChars)
+{
+        static_assert(has_xstd_from_chars<int>);
+        static_assert(has_xstd_from_chars<char>);
+        static_assert(has_xstd_from_chars<unsigned long long>);
+        static_assert(has_xstd_from_chars<xstd::int128>);
+        static_assert(has_xstd_from_chars<xstd::uint128>);
+        static_assert(not has_xstd_from_chars<bool>);
+}
+
+template<class T>
+[[nodiscard]] auto rendered(T value, int base)
+        -> std::string
+{
+        auto buffer = std::array<char, xstd::to_chars_max_size<T>>{};
+        auto const result = xstd::to_chars(buffer.data(), buffer.data() + buffer.size(), value, base);
+        BOOST_CHECK(result.ec == std::errc{});
+        return std::string(buffer.data(), result.ptr);
+}
+
+// Parsed in full or not at all: the whole text is the number, so ptr must reach its end.
+template<class T>
+[[nodiscard]] auto parsed(std::string_view text, int base)
+        -> T
+{
+        auto value = T{};
+        auto const result = xstd::from_chars(text.data(), text.data() + text.size(), value, base);
+        BOOST_CHECK(result.ec == std::errc{});
+        BOOST_CHECK(result.ptr == text.data() + text.size());
+        return value;
+}
+
+// Either side of every power of the base, where a chunk boundary falls inside the digits.
+BOOST_AUTO_TEST_CASE_TEMPLATE(RoundTripsPowersOfTheBase, T, xstd::test::exact_width_unsigned_integer_types)
+{
+        for (auto base = 2; base <= 36; ++base) {
+                auto const radix = static_cast<T>(base);
+                for (auto power = T{1};; power = power * radix) {
+                        BOOST_CHECK_EQUAL(parsed<T>(rendered(static_cast<T>(power - T{1}), base), base), static_cast<T>(power - T{1}));
+                        BOOST_CHECK_EQUAL(parsed<T>(rendered(power, base), base), power);
+                        BOOST_CHECK_EQUAL(parsed<T>(rendered(static_cast<T>(power + T{1}), base), base), static_cast<T>(power + T{1}));
+                        if (power > xstd::numeric_limits<T>::max() / radix) {
+                                break;
+                        }
+                }
+                BOOST_CHECK_EQUAL(parsed<T>(rendered(xstd::numeric_limits<T>::max(), base), base), xstd::numeric_limits<T>::max());
+        }
+}
+
+// And below zero, down to min(), whose magnitude only the unsigned counterpart holds.
+BOOST_AUTO_TEST_CASE_TEMPLATE(RoundTripsPowersOfTheBaseNegated, T, xstd::test::exact_width_signed_integer_types)
+{
+        for (auto base = 2; base <= 36; ++base) {
+                auto const radix = static_cast<T>(base);
+                for (auto power = T{1};; power = power * radix) {
+                        BOOST_CHECK_EQUAL(parsed<T>(rendered(static_cast<T>(-power), base), base), static_cast<T>(-power));
+                        if (power > xstd::numeric_limits<T>::max() / radix) {
+                                break;
+                        }
+                }
+                BOOST_CHECK_EQUAL(parsed<T>(rendered(xstd::numeric_limits<T>::min(), base), base), xstd::numeric_limits<T>::min());
+                BOOST_CHECK_EQUAL(parsed<T>(rendered(xstd::numeric_limits<T>::max(), base), base), xstd::numeric_limits<T>::max());
+        }
+}
+
+// One past a limit, reported with ptr past every digit and value left as it was.
+template<class T>
+auto check_out_of_range(std::string_view text)
+        -> void
+{
+        auto value = T{7};
+        auto const result = xstd::from_chars(text.data(), text.data() + text.size(), value, 10);
+        BOOST_CHECK(result.ec == std::errc::result_out_of_range);
+        BOOST_CHECK(result.ptr == text.data() + text.size());
+        BOOST_CHECK_EQUAL(value, T{7});
+}
+
+// A limit's decimal digits never end in 9, so bumping the last one is the limit plus one at the same length.
+[[nodiscard]] auto bumped(std::string digits)
+        -> std::string
+{
+        ++digits.back();
+        return digits;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(OutOfRangeUnsigned, T, xstd::test::exact_width_unsigned_integer_types)
+{
+        check_out_of_range<T>(bumped(rendered(xstd::numeric_limits<T>::max(), 10)));
+        check_out_of_range<T>(rendered(xstd::numeric_limits<T>::max(), 10) + "0");
+        check_out_of_range<T>(std::string(200, '9'));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(OutOfRangeSigned, T, xstd::test::exact_width_signed_integer_types)
+{
+        check_out_of_range<T>(bumped(rendered(xstd::numeric_limits<T>::max(), 10)));
+        check_out_of_range<T>(bumped(rendered(xstd::numeric_limits<T>::min(), 10)));
+        check_out_of_range<T>(rendered(xstd::numeric_limits<T>::min(), 10) + "0");
+        check_out_of_range<T>("-" + std::string(200, '9'));
+}
+
+// No digits, or none after the sign: ptr stays at first and value is untouched.
+template<class T>
+auto check_invalid(std::string_view text, int base)
+        -> void
+{
+        auto value = T{7};
+        auto const result = xstd::from_chars(text.data(), text.data() + text.size(), value, base);
+        BOOST_CHECK(result.ec == std::errc::invalid_argument);
+        BOOST_CHECK(result.ptr == text.data());
+        BOOST_CHECK_EQUAL(value, T{7});
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(InvalidArgument, T, xstd::test::exact_width_signed_integer_types)
+{
+        check_invalid<T>("", 10);
+        check_invalid<T>("-", 10);
+        check_invalid<T>("+1", 10);
+        check_invalid<T>(" 1", 10);
+        check_invalid<T>("--1", 10);
+        check_invalid<T>("z", 35);
+        check_invalid<T>("2", 2);
+}
+
+// The minus sign is part of the pattern only when the type is signed.
+BOOST_AUTO_TEST_CASE_TEMPLATE(InvalidArgumentUnsigned, T, xstd::test::exact_width_unsigned_integer_types)
+{
+        check_invalid<T>("-1", 10);
+        check_invalid<T>("-0", 10);
+        check_invalid<T>("", 16);
+}
+
+// A match stops at the first character outside the pattern, and letters count in either case.
+BOOST_AUTO_TEST_CASE_TEMPLATE(StopsAtTheFirstNonDigit, T, xstd::test::exact_width_signed_integer_types)
+{
+        auto const text = std::string_view{"-0x7f"};
+        auto value = T{};
+        auto const prefix = xstd::from_chars(text.data(), text.data() + text.size(), value, 16);
+        BOOST_CHECK(prefix.ec == std::errc{});
+        BOOST_CHECK(prefix.ptr == text.data() + 2);
+        BOOST_CHECK_EQUAL(value, T{0});
+
+        auto const mixed = std::string_view{"7Fz"};
+        auto const hex = xstd::from_chars(mixed.data(), mixed.data() + mixed.size(), value, 16);
+        BOOST_CHECK(hex.ec == std::errc{});
+        BOOST_CHECK(hex.ptr == mixed.data() + 2);
+        BOOST_CHECK_EQUAL(value, T{127});
+
+        BOOST_CHECK_EQUAL(parsed<T>("-Z", 36), T{-35});
+        BOOST_CHECK_EQUAL(parsed<T>("-0", 10), T{0});
+}
+
+// Leading zeros are digits of the match but not of the limit: any number of them still parses.
+BOOST_AUTO_TEST_CASE_TEMPLATE(LeadingZeros, T, xstd::test::exact_width_unsigned_integer_types)
+{
+        BOOST_CHECK_EQUAL(parsed<T>(std::string(100, '0'), 10), T{0});
+        BOOST_CHECK_EQUAL(parsed<T>(std::string(100, '0') + "1", 2), T{1});
+        BOOST_CHECK_EQUAL(parsed<T>(std::string(100, '0') + rendered(xstd::numeric_limits<T>::max(), 10), 10), xstd::numeric_limits<T>::max());
+}
+
+// A non-digit at every position of the first chunk and past it, so inside and after each eight-digit load.
+BOOST_AUTO_TEST_CASE_TEMPLATE(StopsInsideAnEightDigitLoad, T, xstd::test::exact_width_unsigned_integer_types)
+{
+        auto const digits = std::string("1234567890123456789012345678901234567890");
+        for (auto const base : {10, 16}) {
+                for (auto length = std::size_t{0}; length < rendered(xstd::numeric_limits<T>::max(), base).size(); ++length) {
+                        auto const text = digits.substr(0, length) + "x" + digits;
+                        auto value = T{7};
+                        auto const result = xstd::from_chars(text.data(), text.data() + text.size(), value, base);
+                        BOOST_CHECK(result.ptr == text.data() + length);
+                        if (length != 0) {
+                                BOOST_CHECK(result.ec == std::errc{});
+                                BOOST_CHECK_EQUAL(value, parsed<T>(digits.substr(0, length), base));
+                        }
+                }
+        }
+}
+
+BOOST_AUTO_TEST_CASE(Int128Boundaries)
+{
+        BOOST_CHECK_EQUAL(parsed<xstd::int128>("-170141183460469231731687303715884105728", 10), xstd::numeric_limits<xstd::int128>::min());
+        BOOST_CHECK_EQUAL(parsed<xstd::int128>("170141183460469231731687303715884105727", 10), xstd::numeric_limits<xstd::int128>::max());
+        BOOST_CHECK_EQUAL(parsed<xstd::uint128>("340282366920938463463374607431768211455", 10), xstd::numeric_limits<xstd::uint128>::max());
+        BOOST_CHECK_EQUAL(parsed<xstd::uint128>("ffffffffffffffffffffffffffffffff", 16), xstd::numeric_limits<xstd::uint128>::max());
+        check_out_of_range<xstd::uint128>("340282366920938463463374607431768211456");
+        check_out_of_range<xstd::int128>("-170141183460469231731687303715884105729");
+
+        // The default base.
+        auto value = xstd::int128{};
+        auto const text = std::string_view{"-42"};
+        auto const result = xstd::from_chars(text.data(), text.data() + text.size(), value);
+        BOOST_CHECK(result.ec == std::errc{});
+        BOOST_CHECK_EQUAL(value, xstd::int128{-42});
+}
+
+#if defined(XSTD_TEST_HAS_BIT_PRECISE) and XSTD_TEST_BIT_PRECISE_MAX >= 256 and __BITINT_MAXWIDTH__ >= 4096
+// Wide enough to be parsed divide-and-conquer, its halves in narrower types: every base, and the limit either side.
+BOOST_AUTO_TEST_CASE(WideBitPreciseSplitsRoundTrip)
+{
+        using U = xstd::test::bit_uint<4096>;
+        using I = xstd::test::bit_int<4096>;
+        auto factorial = U{1};
+        for (auto k = 2; k <= 500; ++k) {
+                factorial = factorial * static_cast<U>(k);
+        }
+        for (auto base = 2; base <= 36; ++base) {
+                auto const radix = static_cast<U>(base);
+                auto power = U{1};
+                while (power <= xstd::numeric_limits<U>::max() / radix) {
+                        power = power * radix;
+                }
+                for (auto const value : {factorial, power, static_cast<U>(power - U{1}), xstd::numeric_limits<U>::max()}) {
+                        BOOST_CHECK(parsed<U>(rendered(value, base), base) == value);
+                }
+        }
+        check_out_of_range<U>(bumped(rendered(xstd::numeric_limits<U>::max(), 10)));
+        check_out_of_range<U>(rendered(xstd::numeric_limits<U>::max(), 10) + "0");
+        BOOST_CHECK(parsed<I>(rendered(xstd::numeric_limits<I>::min(), 10), 10) == xstd::numeric_limits<I>::min());
+        check_out_of_range<I>(bumped(rendered(xstd::numeric_limits<I>::min(), 10)));
+        check_out_of_range<I>(bumped(rendered(xstd::numeric_limits<I>::max(), 10)));
+}
+#endif
+
+// Asked of every type in the lists: a third party is constexpr only where it says so.
+template<class T>
+[[nodiscard]] consteval auto parses_at_compile_time(std::string_view text, int base, T expected)
+        -> bool
+{
+        auto value = T{};
+        auto const result = xstd::from_chars(text.data(), text.data() + text.size(), value, base);
+        return result.ec == std::errc{} and result.ptr == text.data() + text.size() and value == expected;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(UsableInAConstantExpression, T, xstd::test::constexpr_exact_width_signed_integer_types)
+{
+        static_assert(parses_at_compile_time("-42", 10, T{-42}));
+        static_assert(parses_at_compile_time("7f", 16, T{127}));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(UsableInAConstantExpressionUnsigned, T, xstd::test::constexpr_exact_width_unsigned_integer_types)
+{
+        static_assert(parses_at_compile_time("255", 10, T{255}));
+        static_assert(parses_at_compile_time("11111111", 2, T{255}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,84 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/charconv/parse_digits.hpp> // parse_digits8, parse_hex_digits8
+#include <boost/test/unit_test.hpp>       // BOOST_AUTO_TEST_CASE, BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_CHECK, BOOST_CHECK_EQUAL
+#include <cstddef>                        // size_t
+#include <cstdint>                        // uint32_t
+#include <optional>                       // optional
+#include <string>                         // string
+
+BOOST_AUTO_TEST_SUITE(CharConvParseDigits)
+
+// Ground truth a character at a time: none at the first that is not a digit in the base.
+[[nodiscard]] auto parsed_one_by_one(std::string const& text, std::uint32_t base)
+        -> std::optional<std::uint32_t>
+{
+        auto value = std::uint32_t{0};
+        for (auto const c : text) {
+                auto const digit =
+                        '0' <= c and c <= '9' ? static_cast<std::uint32_t>(c - '0') :
+                        'a' <= c and c <= 'z' ? static_cast<std::uint32_t>(c - 'a' + 10) :
+                        'A' <= c and c <= 'Z' ? static_cast<std::uint32_t>(c - 'A' + 10) : base;
+                if (digit >= base) {
+                        return std::nullopt;
+                }
+                value = value * base + digit;
+        }
+        return value;
+}
+
+BOOST_AUTO_TEST_CASE(Decimal)
+{
+        static_assert(xstd::parse_digits8("00000000") == 0U);
+        static_assert(xstd::parse_digits8("12345678") == 12'345'678U);
+        static_assert(xstd::parse_digits8("99999999") == 99'999'999U);
+        static_assert(not xstd::parse_digits8("1234567a"));
+
+        // Every position, with the bytes either side of the digits and one with the high bit set.
+        for (auto position = std::size_t{0}; position != 8; ++position) {
+                for (auto const c : {'/', ':', ' ', 'a', '\0', static_cast<char>('5' | 0x80)}) {
+                        auto text = std::string("31415926");
+                        text[position] = c;
+                        BOOST_CHECK(not xstd::parse_digits8(text.data()));
+                }
+        }
+        for (auto const* text : {"01234567", "89012345", "00000001", "10000000", "98765432"}) {
+                BOOST_CHECK(xstd::parse_digits8(text) == parsed_one_by_one(text, 10));
+        }
+}
+
+BOOST_AUTO_TEST_CASE(Hexadecimal)
+{
+        static_assert(xstd::parse_hex_digits8("00000000") == 0U);
+        static_assert(xstd::parse_hex_digits8("DeadBeef") == 0xdead'beefU);
+        static_assert(xstd::parse_hex_digits8("ffffffff") == 0xffff'ffffU);
+        static_assert(not xstd::parse_hex_digits8("0123456g"));
+
+        // Every position, with the bytes either side of each of the three ranges.
+        for (auto position = std::size_t{0}; position != 8; ++position) {
+                for (auto const c : {'/', ':', '@', 'G', '`', 'g', '\0', static_cast<char>('a' | 0x80)}) {
+                        auto text = std::string("0a1B2c3D");
+                        text[position] = c;
+                        BOOST_CHECK(not xstd::parse_hex_digits8(text.data()));
+                }
+        }
+        for (auto const* text : {"01234567", "89abcdef", "89ABCDEF", "aAbBcCdD", "00000001", "f0000000"}) {
+                BOOST_CHECK(xstd::parse_hex_digits8(text) == parsed_one_by_one(text, 16));
+        }
+}
+
+// Decimal digits are hexadecimal digits too, with the same text read in the larger base.
+BOOST_AUTO_TEST_CASE(DecimalDigitsAreHexDigits)
+{
+        for (auto value = std::uint32_t{0}; value < 100'000'000; value += 999'983) {
+                auto text = std::to_string(value);
+                text.insert(0, 8 - text.size(), '0');
+                BOOST_CHECK_EQUAL(xstd::parse_digits8(text.data()).value(), value);
+                BOOST_CHECK(xstd::parse_hex_digits8(text.data()) == parsed_one_by_one(text, 16));
+        }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
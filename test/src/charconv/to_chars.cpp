@@ -3,18 +3,21 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          http://www.boost.org/LICENSE_1_0.txt)
 
-#include <xstd/charconv/to_chars.hpp>      // to_chars, to_chars_max_size
+#include <xstd/charconv/to_chars.hpp>      // basic_to_chars_result, to_chars, to_chars_max_size, to_chars_size
 #include <xstd/concepts/integer.hpp>       // integer
 #include <xstd/cstdint.hpp>                // int128, uint128
+#include <xstd/test/bit_precise.hpp>       // XSTD_TEST_HAS_BIT_PRECISE, XSTD_TEST_BIT_PRECISE_MAX, bit_int, bit_uint
 #include <xstd/test/exact_width_types.hpp> // std_signed_types, exact_width_signed_integer_types, exact_width_unsigned_integer_types
 #include <xstd/limits.hpp>                 // numeric_limits
+#include <xstd/type_traits.hpp>            // make_unsigned_t
 #include <boost/test/unit_test.hpp>        // BOOST_AUTO_TEST_CASE, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_CHECK, BOOST_CHECK_EQUAL
+#include <algorithm>                       // equal
 #include <array>                           // array
 #include <charconv>                        // to_chars, to_chars_result
 #include <concepts>                        // same_as
 #include <cstddef>                         // size_t
 #include <string>                          // string
-#include <string_view>                     // string_view
+#include <string_view>                     // basic_string_view, string_view, u8string_view, wstring_view
 #include <system_error>                    // errc
 
 BOOST_AUTO_TEST_SUITE(CharConvToChars)
@@ -113,7 +116,7 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(MaxSizeHoldsTheWorstCase, T, xstd::test::exact_wid
         BOOST_CHECK(short_buffer.ec == std::errc::value_too_large);
         BOOST_CHECK(short_buffer.ptr == buffer.data() + buffer.size() - 1);
 
-        // No room at all, answered before any digit is counted: the second return.
+        // No room at all, answered by the same return before anything is written.
         auto const empty = xstd::to_chars(buffer.data(), buffer.data(), xstd::numeric_limits<T>::min(), 2);
         BOOST_CHECK(empty.ec == std::errc::value_too_large);
         BOOST_CHECK(empty.ptr == buffer.data());
@@ -129,7 +132,7 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(MaxSizeHoldsTheWorstCaseUnsigned, T, xstd::test::e
         BOOST_CHECK(short_buffer.ec == std::errc::value_too_large);
         BOOST_CHECK(short_buffer.ptr == buffer.data() + buffer.size() - 1);
 
-        // As above: no room at all, answered before any digit is counted.
+        // As above: no room at all, answered before anything is written.
         auto const empty = xstd::to_chars(buffer.data(), buffer.data(), xstd::numeric_limits<T>::max(), 2);
         BOOST_CHECK(empty.ec == std::errc::value_too_large);
         BOOST_CHECK(empty.ptr == buffer.data());
@@ -165,6 +168,128 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(HexBoundariesMatchGroundTruthUnsigned, T, xstd::te
         BOOST_CHECK_EQUAL(rendered(T{2}, 16), "2");
 }
 
+// Ground truth a digit at a time, the loop the fallback ran before it took chunks.
+template<class T>
+[[nodiscard]] auto rendered_digit_by_digit(T value, int base)
+        -> std::string
+{
+        auto const radix = static_cast<T>(base);
+        auto digits = std::string{};
+        do {
+                digits.insert(digits.begin(), "0123456789abcdefghijklmnopqrstuvwxyz"[static_cast<std::size_t>(value % radix)]);
+                value = value / radix;
+        } while (value != T{0});
+        return digits;
+}
+
+// Either side of every power of the base, which is where a chunk's leading zeros must survive.
+BOOST_AUTO_TEST_CASE_TEMPLATE(PowersOfTheBaseMatchDigitByDigit, T, xstd::test::exact_width_unsigned_integer_types)
+{
+        for (auto base = 2; base <= 36; ++base) {
+                auto const radix = static_cast<T>(base);
+                for (auto power = T{1};; power = power * radix) {
+                        BOOST_CHECK_EQUAL(rendered(static_cast<T>(power - T{1}), base), rendered_digit_by_digit(static_cast<T>(power - T{1}), base));
+                        BOOST_CHECK_EQUAL(rendered(power, base), rendered_digit_by_digit(power, base));
+                        BOOST_CHECK_EQUAL(rendered(static_cast<T>(power + T{1}), base), rendered_digit_by_digit(static_cast<T>(power + T{1}), base));
+                        if (power > xstd::numeric_limits<T>::max() / radix) {
+                                break;
+                        }
+                }
+        }
+}
+
+// And below zero, where the sign goes ahead of the chunks rather than into one.
+BOOST_AUTO_TEST_CASE_TEMPLATE(PowersOfTheBaseMatchDigitByDigitNegated, T, xstd::test::exact_width_signed_integer_types)
+{
+        for (auto base = 2; base <= 36; ++base) {
+                auto const radix = static_cast<T>(base);
+                for (auto power = T{1};; power = power * radix) {
+                        BOOST_CHECK_EQUAL(rendered(static_cast<T>(-power), base), "-" + rendered_digit_by_digit(power, base));
+                        if (power > xstd::numeric_limits<T>::max() / radix) {
+                                break;
+                        }
+                }
+        }
+}
+
+// Every entry of the two-digit table, in both halves of a pair and at an odd count.
+BOOST_AUTO_TEST_CASE_TEMPLATE(DecimalDigitPairsMatchDigitByDigit, T, xstd::test::exact_width_unsigned_integer_types)
+{
+        // Wrapping around in the narrower types only repeats a value already checked.
+        for (auto i = 0; i < 10'000; ++i) {
+                auto const value = static_cast<T>(i);
+                BOOST_CHECK_EQUAL(rendered(value, 10), rendered_digit_by_digit(value, 10));
+        }
+}
+
+// Every bit position in the shifted bases, where an octal digit straddles two chunks.
+BOOST_AUTO_TEST_CASE_TEMPLATE(PowerOfTwoBasesMatchDigitByDigit, T, xstd::test::exact_width_unsigned_integer_types)
+{
+        for (auto const base : {2, 4, 8, 16, 32}) {
+                for (auto bit = std::size_t{0}; bit < static_cast<std::size_t>(xstd::numeric_limits<T>::digits); ++bit) {
+                        auto const single = static_cast<T>(T{1} << bit);
+                        auto const ones = static_cast<T>(xstd::numeric_limits<T>::max() >> bit);
+                        BOOST_CHECK_EQUAL(rendered(single, base), rendered_digit_by_digit(single, base));
+                        BOOST_CHECK_EQUAL(rendered(ones, base), rendered_digit_by_digit(ones, base));
+                }
+        }
+}
+
+// And min(), whose magnitude only the unsigned counterpart holds.
+BOOST_AUTO_TEST_CASE_TEMPLATE(PowerOfTwoBasesMatchDigitByDigitNegated, T, xstd::test::exact_width_signed_integer_types)
+{
+        using U = xstd::make_unsigned_t<T>;
+        auto const magnitude = static_cast<U>(static_cast<U>(xstd::numeric_limits<T>::max()) + U{1});
+        for (auto const base : {2, 4, 8, 16, 32}) {
+                BOOST_CHECK_EQUAL(rendered(xstd::numeric_limits<T>::min(), base), "-" + rendered_digit_by_digit(magnitude, base));
+        }
+}
+
+// The size is what gets written: zero, either side of every power of every base, and max().
+BOOST_AUTO_TEST_CASE_TEMPLATE(SizeIsWhatIsWritten, T, xstd::test::exact_width_unsigned_integer_types)
+{
+        for (auto base = 2; base <= 36; ++base) {
+                BOOST_CHECK_EQUAL(xstd::to_chars_size(T{0}, base), std::size_t{1});
+                BOOST_CHECK_EQUAL(xstd::to_chars_size(xstd::numeric_limits<T>::max(), base), rendered(xstd::numeric_limits<T>::max(), base).size());
+                auto const radix = static_cast<T>(base);
+                for (auto power = T{1};; power = power * radix) {
+                        BOOST_CHECK_EQUAL(xstd::to_chars_size(static_cast<T>(power - T{1}), base), rendered(static_cast<T>(power - T{1}), base).size());
+                        BOOST_CHECK_EQUAL(xstd::to_chars_size(power, base), rendered(power, base).size());
+                        BOOST_CHECK_EQUAL(xstd::to_chars_size(static_cast<T>(power + T{1}), base), rendered(static_cast<T>(power + T{1}), base).size());
+                        if (power > xstd::numeric_limits<T>::max() / radix) {
+                                break;
+                        }
+                }
+        }
+}
+
+// And the sign counted in: min(), whose magnitude is a power of two, and the negated powers.
+BOOST_AUTO_TEST_CASE_TEMPLATE(SizeIsWhatIsWrittenSigned, T, xstd::test::exact_width_signed_integer_types)
+{
+        for (auto base = 2; base <= 36; ++base) {
+                BOOST_CHECK_EQUAL(xstd::to_chars_size(xstd::numeric_limits<T>::min(), base), rendered(xstd::numeric_limits<T>::min(), base).size());
+                auto const radix = static_cast<T>(base);
+                for (auto power = T{1};; power = power * radix) {
+                        BOOST_CHECK_EQUAL(xstd::to_chars_size(static_cast<T>(-power), base), rendered(static_cast<T>(-power), base).size());
+                        if (power > xstd::numeric_limits<T>::max() / radix) {
+                                break;
+                        }
+                }
+        }
+}
+
+// The delegated domain is counted too, character types included: to_chars accepts them.
+BOOST_AUTO_TEST_CASE(SizeCoversTheDelegatedDomain)
+{
+        static_assert(xstd::to_chars_size('a') == 2);
+        static_assert(xstd::to_chars_size(static_cast<signed char>(-128)) == 4);
+        static_assert(xstd::to_chars_size(char8_t{255}, 16) == 2);
+        static_assert(xstd::to_chars_size(0) == 1);
+        static_assert(xstd::to_chars_size(-1LL) == 2);
+        BOOST_CHECK_EQUAL(xstd::to_chars_size(xstd::numeric_limits<long long>::min()), rendered_by_std(xstd::numeric_limits<long long>::min(), 10).size());
+        BOOST_CHECK_EQUAL(xstd::to_chars_size(xstd::numeric_limits<unsigned long long>::max(), 3), rendered_by_std(xstd::numeric_limits<unsigned long long>::max(), 3).size());
+}
+
 BOOST_AUTO_TEST_CASE(Int128Boundaries)
 {
         BOOST_CHECK_EQUAL(rendered(xstd::numeric_limits<xstd::int128>::min(), 10), "-170141183460469231731687303715884105728");
@@ -190,6 +315,32 @@ BOOST_AUTO_TEST_CASE(Int128Boundaries)
         BOOST_CHECK(truncated.ec == std::errc::value_too_large);
 }
 
+#if defined(XSTD_TEST_HAS_BIT_PRECISE) and XSTD_TEST_BIT_PRECISE_MAX >= 256 and __BITINT_MAXWIDTH__ >= 4096
+// Wide enough to be split by powers of the chunk radix, several levels deep: every base, and the boundaries of a split.
+BOOST_AUTO_TEST_CASE(WideBitPreciseSplitsMatchDigitByDigit)
+{
+        using U = xstd::test::bit_uint<4096>;
+        using I = xstd::test::bit_int<4096>;
+        auto factorial = U{1};
+        for (auto k = 2; k <= 500; ++k) {
+                factorial = factorial * static_cast<U>(k);
+        }
+        for (auto base = 2; base <= 36; ++base) {
+                auto const radix = static_cast<U>(base);
+                auto power = U{1};
+                while (power <= xstd::numeric_limits<U>::max() / radix) {
+                        power = power * radix;
+                }
+                for (auto const value : {factorial, power, static_cast<U>(power - U{1}), xstd::numeric_limits<U>::max()}) {
+                        BOOST_CHECK_EQUAL(rendered(value, base), rendered_digit_by_digit(value, base));
+                        BOOST_CHECK_EQUAL(xstd::to_chars_size(value, base), rendered_digit_by_digit(value, base).size());
+                }
+        }
+        auto const magnitude = static_cast<U>(static_cast<U>(xstd::numeric_limits<I>::max()) + U{1});
+        BOOST_CHECK_EQUAL(rendered(xstd::numeric_limits<I>::min(), 10), "-" + rendered_digit_by_digit(magnitude, 10));
+}
+#endif
+
 // A constant expression, which is what std::formatter<div_result<I>>::format needs for P3391.
 template<class T>
 [[nodiscard]] consteval auto rendered_at_compile_time(T value, int base, std::string_view expected)
@@ -208,6 +359,8 @@ BOOST_AUTO_TEST_CASE(UsableInAConstantExpression)
                                                "-170141183460469231731687303715884105728"));
         static_assert(rendered_at_compile_time(xstd::numeric_limits<xstd::uint128>::max(), 16,
                                                "ffffffffffffffffffffffffffffffff"));
+        static_assert(xstd::to_chars_size(xstd::numeric_limits<xstd::int128>::min()) == 40);
+        static_assert(xstd::to_chars_size(xstd::numeric_limits<xstd::uint128>::max(), 16) == 32);
 }
 
 // Asked of every type in the lists: a third party is constexpr only where it says so.
@@ -231,6 +384,8 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(UsableInAConstantExpressionPerTypeUnsigned, T, xst
 {
         static_assert(renders_at_compile_time(xstd::numeric_limits<T>::max(), 10));
         static_assert(renders_at_compile_time(xstd::numeric_limits<T>::min(), 36));
+        static_assert(xstd::to_chars_size(xstd::numeric_limits<T>::min(), 36) == 1);
+        static_assert(xstd::to_chars_size(xstd::numeric_limits<T>::max(), 2) == xstd::numeric_limits<T>::digits);
 }
 
 // A buffer too small reports value_too_large and leaves ptr at last, not a truncation.
@@ -247,4 +402,52 @@ BOOST_AUTO_TEST_CASE(ShortBuffer)
         BOOST_CHECK(wide.ptr == buffer.data() + buffer.size());
 }
 
+
+// Every other character type, written by the same kernels: the char rendering, code unit for code unit.
+template<class CharT, class T>
+auto check_character_type(T value, int base)
+        -> void
+{
+        auto narrow = std::array<char, xstd::to_chars_max_size<T>>{};
+        auto const expected = xstd::to_chars(narrow.data(), narrow.data() + narrow.size(), value, base);
+        auto buffer = std::array<CharT, xstd::to_chars_max_size<T>>{};
+        auto const result = xstd::to_chars(buffer.data(), buffer.data() + buffer.size(), value, base);
+        static_assert(std::same_as<decltype(result), xstd::basic_to_chars_result<CharT> const>);
+        BOOST_CHECK(result.ec == std::errc{});
+        BOOST_CHECK(std::ranges::equal(std::basic_string_view<CharT>(buffer.data(), result.ptr), std::string_view(narrow.data(), expected.ptr),
+                                       [](CharT c, char n) { return c == static_cast<CharT>(n); }));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(OtherCharacterTypesMatchChar, T, xstd::test::exact_width_signed_integer_types)
+{
+        for (auto const base : {2, 8, 10, 16, 36}) {
+                for (auto const value : {T{0}, T{-1}, xstd::numeric_limits<T>::min(), xstd::numeric_limits<T>::max()}) {
+                        check_character_type<wchar_t>(value, base);
+                        check_character_type<char8_t>(value, base);
+                        check_character_type<char16_t>(value, base);
+                        check_character_type<char32_t>(value, base);
+                }
+        }
+}
+
+// Short buffers and constant expressions alike.
+BOOST_AUTO_TEST_CASE(OtherCharacterTypes)
+{
+        auto buffer = std::array<char16_t, 4>{};
+        auto const result = xstd::to_chars(buffer.data(), buffer.data() + buffer.size(), 123456);
+        BOOST_CHECK(result.ec == std::errc::value_too_large);
+        BOOST_CHECK(result.ptr == buffer.data() + buffer.size());
+
+        static_assert([] {
+                auto wide = std::array<wchar_t, 64>{};
+                auto const last = xstd::to_chars(wide.data(), wide.data() + wide.size(), xstd::numeric_limits<xstd::int128>::min()).ptr;
+                return std::wstring_view(wide.data(), last) == L"-170141183460469231731687303715884105728";
+        }());
+        static_assert([] {
+                auto utf8 = std::array<char8_t, 64>{};
+                auto const last = xstd::to_chars(utf8.data(), utf8.data() + utf8.size(), 0xbeefU, 16).ptr;
+                return std::u8string_view(utf8.data(), last) == u8"beef";
+        }());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,169 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/charconv/to_chars.hpp>       // to_chars, to_chars_max_size
+#include <xstd/charconv/to_chars_batch.hpp> // to_chars_batch
+#include <xstd/cstdint.hpp>                 // int128, uint128
+#include <xstd/test/exact_width_types.hpp>  // exact_width_signed_integer_types, exact_width_unsigned_integer_types, std_signed_types
+#include <xstd/limits.hpp>                  // numeric_limits
+#include <boost/test/unit_test.hpp>         // BOOST_AUTO_TEST_CASE, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_CHECK, BOOST_CHECK_EQUAL
+#include <algorithm>                        // all_of
+#include <array>                            // array
+#include <cstddef>                          // size_t
+#include <span>                             // span
+#include <string>                           // string
+#include <string_view>                      // string_view
+#include <system_error>                     // errc
+#include <type_traits>                      // make_unsigned_t, remove_cvref_t
+#include <utility>                          // pair
+#include <vector>                           // vector
+
+BOOST_AUTO_TEST_SUITE(CharConvToCharsBatch)
+
+// One value at a time through to_chars, delimited, and the ends that layout has: what the batch must agree with.
+template<class T>
+[[nodiscard]] auto joined(std::vector<T> const& values, char delimiter, int base)
+        -> std::pair<std::string, std::vector<std::size_t>>
+{
+        auto text = std::string{};
+        auto ends = std::vector<std::size_t>{};
+        for (auto const value : values) {
+                if (not text.empty()) {
+                        text += delimiter;
+                }
+                auto buffer = std::array<char, xstd::to_chars_max_size<T>>{};
+                auto const result = xstd::to_chars(buffer.data(), buffer.data() + buffer.size(), value, base);
+                text.append(buffer.data(), result.ptr);
+                ends.push_back(text.size());
+        }
+        return {text, ends};
+}
+
+template<class T>
+auto check_batch(std::vector<T> const& values, char delimiter, int base)
+        -> void
+{
+        auto const [expected, expected_ends] = joined(values, delimiter, base);
+        auto buffer = std::vector<char>(values.size() * (xstd::to_chars_max_size<T> + 1));
+        auto ends = std::vector<std::size_t>(values.size());
+        auto const result = xstd::to_chars_batch(std::span{values}, buffer.data(), buffer.data() + buffer.size(), delimiter, std::span{ends}, base);
+        BOOST_CHECK(result.ec == std::errc{});
+        BOOST_CHECK_EQUAL(std::string(buffer.data(), result.ptr), expected);
+        BOOST_CHECK(ends == expected_ends);
+}
+
+// Zero, the extremes and the powers of the base either side: every chunk boundary, in every base.
+BOOST_AUTO_TEST_CASE_TEMPLATE(MatchesToCharsOneByOne, T, xstd::test::exact_width_unsigned_integer_types)
+{
+        for (auto base = 2; base <= 36; ++base) {
+                auto values = std::vector<T>{T{0}, xstd::numeric_limits<T>::max()};
+                auto const radix = static_cast<T>(base);
+                for (auto power = T{1};; power = power * radix) {
+                        values.push_back(static_cast<T>(power - T{1}));
+                        values.push_back(power);
+                        if (power > xstd::numeric_limits<T>::max() / radix) {
+                                break;
+                        }
+                }
+                check_batch(values, ',', base);
+        }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(MatchesToCharsOneByOneSigned, T, xstd::test::exact_width_signed_integer_types)
+{
+        for (auto base = 2; base <= 36; ++base) {
+                auto values = std::vector<T>{T{0}, xstd::numeric_limits<T>::min(), xstd::numeric_limits<T>::max(), T{-1}};
+                auto const radix = static_cast<T>(base);
+                for (auto power = T{1};; power = power * radix) {
+                        values.push_back(power);
+                        values.push_back(static_cast<T>(-power));
+                        if (power > xstd::numeric_limits<T>::max() / radix) {
+                                break;
+                        }
+                }
+                check_batch(values, ' ', base);
+        }
+}
+
+// Nothing to write is success at first; one value has no delimiter at all.
+BOOST_AUTO_TEST_CASE(EmptyAndSingle)
+{
+        auto buffer = std::array<char, 8>{};
+        auto ends = std::array<std::size_t, 1>{};
+        auto const none = xstd::to_chars_batch(std::span<int const>{}, buffer.data(), buffer.data(), ',', std::span{ends});
+        BOOST_CHECK(none.ec == std::errc{});
+        BOOST_CHECK(none.ptr == buffer.data());
+
+        auto const one = std::array{-42};
+        auto const single = xstd::to_chars_batch(std::span{one}, buffer.data(), buffer.data() + buffer.size(), ',', std::span{ends});
+        BOOST_CHECK(single.ec == std::errc{});
+        BOOST_CHECK_EQUAL(std::string(buffer.data(), single.ptr), "-42");
+        BOOST_CHECK_EQUAL(ends[0], std::size_t{3});
+}
+
+// A buffer one short writes nothing, leaves ptr at last, and the ends still tell how much was needed.
+BOOST_AUTO_TEST_CASE(ShortBuffer)
+{
+        auto const values = std::array{xstd::numeric_limits<xstd::int128>::min(), xstd::int128{7}};
+        auto buffer = std::array<char, 41>{};
+        auto ends = std::array<std::size_t, 2>{};
+        auto const result = xstd::to_chars_batch(std::span{values}, buffer.data(), buffer.data() + buffer.size(), ';', std::span{ends});
+        BOOST_CHECK(result.ec == std::errc::value_too_large);
+        BOOST_CHECK(result.ptr == buffer.data() + buffer.size());
+        BOOST_CHECK_EQUAL(ends[1], std::size_t{42});
+        BOOST_CHECK(std::ranges::all_of(buffer, [](char c) { return c == '\0'; }));
+
+        auto wider = std::array<char, 42>{};
+        auto const fits = xstd::to_chars_batch(std::span{values}, wider.data(), wider.data() + wider.size(), ';', std::span{ends});
+        BOOST_CHECK(fits.ec == std::errc{});
+        BOOST_CHECK_EQUAL(std::string(wider.data(), fits.ptr), "-170141183460469231731687303715884105728;7");
+}
+
+// Eight digits are stored at a time, but never outside the result, even where the buffer is exactly its size.
+BOOST_AUTO_TEST_CASE_TEMPLATE(WritesNothingOutsideTheResult, T, xstd::test::std_signed_types)
+{
+        using U = std::make_unsigned_t<T>;
+        auto const values = std::vector<T>{
+                T{1}, xstd::numeric_limits<T>::min(), T{22}, xstd::numeric_limits<T>::max(), T{-33}, T{0}, T{4}
+        };
+        auto const unsigned_values = std::vector<U>{
+                U{1}, xstd::numeric_limits<U>::max(), U{22}, U{0}, U{4}
+        };
+        constexpr auto guard = std::size_t{8};
+        auto const check = [](auto const& batch) {
+                using V = typename std::remove_cvref_t<decltype(batch)>::value_type;
+                auto const [expected, expected_ends] = joined(batch, ',', 10);
+                auto buffer = std::vector<char>(guard + expected.size() + guard, '#');
+                auto ends = std::vector<std::size_t>(batch.size());
+                auto const first = buffer.data() + guard;
+                auto const result = xstd::to_chars_batch(std::span<V const>{batch}, first, first + expected.size(), ',', std::span{ends});
+                BOOST_CHECK(result.ec == std::errc{});
+                BOOST_CHECK_EQUAL(std::string(first, result.ptr), expected);
+                BOOST_CHECK_EQUAL(std::string(buffer.data(), first), std::string(guard, '#'));
+                BOOST_CHECK_EQUAL(std::string(result.ptr, buffer.data() + buffer.size()), std::string(guard, '#'));
+        };
+        check(values);
+        check(unsigned_values);
+}
+
+// A constant expression as well, for the xstd types, which to_chars is.
+[[nodiscard]] consteval auto batched_at_compile_time()
+        -> bool
+{
+        auto const values = std::array{xstd::uint128{0}, xstd::numeric_limits<xstd::uint128>::max(), xstd::uint128{255}};
+        auto buffer = std::array<char, 64>{};
+        auto ends = std::array<std::size_t, 3>{};
+        auto const result = xstd::to_chars_batch(std::span{values}, buffer.data(), buffer.data() + buffer.size(), '|', std::span{ends}, 16);
+        return result.ec == std::errc{} and
+               std::string_view{buffer.data(), result.ptr} == "0|ffffffffffffffffffffffffffffffff|ff" and
+               ends == std::array<std::size_t, 3>{1, 34, 37};
+}
+
+BOOST_AUTO_TEST_CASE(UsableInAConstantExpression)
+{
+        static_assert(batched_at_compile_time());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
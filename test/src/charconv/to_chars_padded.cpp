@@ -0,0 +1,166 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/charconv/to_chars.hpp>        // to_chars, to_chars_max_size
+#include <xstd/charconv/to_chars_padded.hpp> // to_chars_grouped, to_chars_padded
+#include <xstd/cstdint.hpp>                  // int128, uint128
+#include <xstd/test/bit_precise.hpp>        // XSTD_TEST_HAS_BIT_PRECISE, XSTD_TEST_BIT_PRECISE_MAX, bit_int
+#include <xstd/test/exact_width_types.hpp>   // exact_width_signed_integer_types, exact_width_unsigned_integer_types
+#include <xstd/limits.hpp>                   // numeric_limits
+#include <boost/test/unit_test.hpp>          // BOOST_AUTO_TEST_CASE, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_CHECK, BOOST_CHECK_EQUAL
+#include <array>                             // array
+#include <cstddef>                           // size_t
+#include <string>                            // string
+#include <string_view>                       // string_view, u16string_view, wstring_view
+#include <system_error>                      // errc
+#include <vector>                            // vector
+
+BOOST_AUTO_TEST_SUITE(CharConvToCharsPadded)
+
+// What to_chars writes, then padded or grouped afterwards: the second pass these do without.
+template<class T>
+[[nodiscard]] auto plain(T value, int base)
+        -> std::string
+{
+        auto buffer = std::array<char, xstd::to_chars_max_size<T>>{};
+        auto const result = xstd::to_chars(buffer.data(), buffer.data() + buffer.size(), value, base);
+        return {buffer.data(), result.ptr};
+}
+
+[[nodiscard]] auto padded(std::string text, std::size_t width, char fill)
+        -> std::string
+{
+        if (text.size() >= width) {
+                return text;
+        }
+        auto const at = fill == '0' and text.front() == '-' ? std::size_t{1} : std::size_t{0};
+        text.insert(at, width - text.size(), fill);
+        return text;
+}
+
+[[nodiscard]] auto grouped(std::string text, std::size_t group, char separator)
+        -> std::string
+{
+        auto const begin = text.front() == '-' ? std::size_t{1} : std::size_t{0};
+        for (auto at = text.size(); at > begin + group; text.insert(at -= group, 1, separator)) {}
+        return text;
+}
+
+template<class T>
+auto check_padded(T value, int base)
+        -> void
+{
+        for (auto const fill : {' ', '0', '*'}) {
+                for (auto const width : {0, 1, 5, 24, 45, 140}) {
+                        auto buffer = std::vector<char>(static_cast<std::size_t>(width) + xstd::to_chars_max_size<T>);
+                        auto const result = xstd::to_chars_padded(buffer.data(), buffer.data() + buffer.size(), value, width, fill, base);
+                        BOOST_CHECK(result.ec == std::errc{});
+                        BOOST_CHECK_EQUAL(std::string(buffer.data(), result.ptr), padded(plain(value, base), static_cast<std::size_t>(width), fill));
+                }
+        }
+}
+
+template<class T>
+auto check_grouped(T value, int base)
+        -> void
+{
+        for (auto const group : {1, 3, 4, 7}) {
+                auto buffer = std::vector<char>(2 * xstd::to_chars_max_size<T>);
+                auto const result = xstd::to_chars_grouped(buffer.data(), buffer.data() + buffer.size(), value, '\'', group, base);
+                BOOST_CHECK(result.ec == std::errc{});
+                BOOST_CHECK_EQUAL(std::string(buffer.data(), result.ptr), grouped(plain(value, base), static_cast<std::size_t>(group), '\''));
+        }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(MatchesToCharsPaddedAfterwards, T, xstd::test::exact_width_signed_integer_types)
+{
+        for (auto const base : {2, 10, 16, 36}) {
+                for (auto const value : {T{0}, T{-1}, T{7}, xstd::numeric_limits<T>::min(), xstd::numeric_limits<T>::max()}) {
+                        check_padded(value, base);
+                        check_grouped(value, base);
+                }
+        }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(MatchesToCharsPaddedAfterwardsUnsigned, T, xstd::test::exact_width_unsigned_integer_types)
+{
+        for (auto const base : {2, 10, 16, 36}) {
+                for (auto const value : {T{0}, T{1}, xstd::numeric_limits<T>::max()}) {
+                        check_padded(value, base);
+                        check_grouped(value, base);
+                }
+        }
+}
+
+#if defined(XSTD_TEST_HAS_BIT_PRECISE) and XSTD_TEST_BIT_PRECISE_MAX >= 256 and __BITINT_MAXWIDTH__ >= 1024
+// Wide enough to be split, and zero-filled far past its digits: 700 of them in base 10 is more than 1024 bits hold.
+BOOST_AUTO_TEST_CASE(WideBitPreciseZeroPadding)
+{
+        using I = xstd::test::bit_int<1024>;
+        for (auto const base : {2, 10, 36}) {
+                for (auto const value : {I{-1}, xstd::numeric_limits<I>::min(), xstd::numeric_limits<I>::max()}) {
+                        for (auto const width : {0, 310, 700, 1100}) {
+                                auto buffer = std::vector<char>(static_cast<std::size_t>(width) + xstd::to_chars_max_size<I>);
+                                auto const result = xstd::to_chars_padded(buffer.data(), buffer.data() + buffer.size(), value, width, '0', base);
+                                BOOST_CHECK(result.ec == std::errc{});
+                                BOOST_CHECK_EQUAL(std::string(buffer.data(), result.ptr), padded(plain(value, base), static_cast<std::size_t>(width), '0'));
+                        }
+                }
+        }
+}
+#endif
+
+// The layouts asked for, and a buffer one short of them.
+BOOST_AUTO_TEST_CASE(Ledger)
+{
+        auto buffer = std::array<char, 64>{};
+        auto const amount = xstd::to_chars_padded(buffer.data(), buffer.data() + 12, xstd::int128{-4'200}, 12, '0');
+        BOOST_CHECK_EQUAL(std::string_view(buffer.data(), amount.ptr), "-00000004200");
+        auto const total = xstd::to_chars_grouped(buffer.data(), buffer.data() + buffer.size(), xstd::numeric_limits<xstd::uint128>::max());
+        BOOST_CHECK_EQUAL(std::string_view(buffer.data(), total.ptr), "340,282,366,920,938,463,463,374,607,431,768,211,455");
+
+        auto const short_padded = xstd::to_chars_padded(buffer.data(), buffer.data() + 11, xstd::int128{-4'200}, 12, '0');
+        BOOST_CHECK(short_padded.ec == std::errc::value_too_large);
+        BOOST_CHECK(short_padded.ptr == buffer.data() + 11);
+        auto const short_grouped = xstd::to_chars_grouped(buffer.data(), buffer.data() + 8, -1'234'567);
+        BOOST_CHECK(short_grouped.ec == std::errc::value_too_large);
+        BOOST_CHECK(short_grouped.ptr == buffer.data() + 8);
+}
+
+// Any character type, as to_chars: the same layouts in wchar_t and char16_t.
+BOOST_AUTO_TEST_CASE(WideCharacters)
+{
+        auto wide = std::array<wchar_t, 64>{};
+        auto const amount = xstd::to_chars_padded(wide.data(), wide.data() + wide.size(), xstd::int128{-4'200}, 8, L'0');
+        BOOST_CHECK(amount.ec == std::errc{});
+        BOOST_CHECK(std::wstring_view(wide.data(), amount.ptr) == L"-0004200");
+        auto const total = xstd::to_chars_grouped(wide.data(), wide.data() + wide.size(), xstd::numeric_limits<xstd::uint128>::max(), L'\u202F');
+        BOOST_CHECK(std::wstring_view(wide.data(), total.ptr) == L"340\u202F282\u202F366\u202F920\u202F938\u202F463\u202F463\u202F374\u202F607\u202F431\u202F768\u202F211\u202F455");
+
+        auto utf16 = std::array<char16_t, 16>{};
+        auto const hex = xstd::to_chars_grouped(utf16.data(), utf16.data() + utf16.size(), -0xDEAD'BEEFLL, u'_', 4, 16);
+        BOOST_CHECK(std::u16string_view(utf16.data(), hex.ptr) == u"-dead_beef");
+        auto const short_padded = xstd::to_chars_padded(utf16.data(), utf16.data() + 4, 7, 5, u'*');
+        BOOST_CHECK(short_padded.ec == std::errc::value_too_large);
+        BOOST_CHECK(short_padded.ptr == utf16.data() + 4);
+}
+
+// Constant expressions, as to_chars is.
+[[nodiscard]] consteval auto laid_out_at_compile_time()
+        -> bool
+{
+        auto buffer = std::array<char, 64>{};
+        auto const padded_result = xstd::to_chars_padded(buffer.data(), buffer.data() + buffer.size(), xstd::uint128{255}, 6, ' ', 16);
+        auto const padded_ok = std::string_view(buffer.data(), padded_result.ptr) == "    ff";
+        auto const grouped_result = xstd::to_chars_grouped(buffer.data(), buffer.data() + buffer.size(), -1'234'567, '.');
+        return padded_ok and std::string_view(buffer.data(), grouped_result.ptr) == "-1.234.567";
+}
+
+BOOST_AUTO_TEST_CASE(UsableInAConstantExpression)
+{
+        static_assert(laid_out_at_compile_time());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
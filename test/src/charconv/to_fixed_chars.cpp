@@ -0,0 +1,68 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/charconv/to_chars.hpp>       // to_chars, to_chars_max_size
+#include <xstd/charconv/to_fixed_chars.hpp> // fixed_chars, to_fixed_chars
+#include <xstd/cstdint.hpp>                 // int128, uint128
+#include <xstd/test/exact_width_types.hpp>  // exact_width_signed_integer_types, exact_width_unsigned_integer_types
+#include <xstd/limits.hpp>                  // numeric_limits
+#include <boost/test/unit_test.hpp>         // BOOST_AUTO_TEST_CASE, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_CHECK, BOOST_CHECK_EQUAL
+#include <array>                            // array
+#include <string_view>                      // string_view
+#include <system_error>                     // errc
+
+BOOST_AUTO_TEST_SUITE(CharConvToFixedChars)
+
+// What to_chars writes into a buffer of the same capacity, character for character.
+template<class T>
+auto check_fixed_chars(T value, int base)
+        -> void
+{
+        auto buffer = std::array<char, xstd::to_chars_max_size<T>>{};
+        auto const result = xstd::to_chars(buffer.data(), buffer.data() + buffer.size(), value, base);
+        BOOST_CHECK(result.ec == std::errc{});
+        auto const fixed = xstd::to_fixed_chars(value, base);
+        BOOST_CHECK_EQUAL(fixed.view(), std::string_view(buffer.data(), result.ptr));
+        BOOST_CHECK_EQUAL(fixed.capacity(), xstd::to_chars_max_size<T>);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(MatchesToChars, T, xstd::test::exact_width_signed_integer_types)
+{
+        for (auto base = 2; base <= 36; ++base) {
+                check_fixed_chars(T{0}, base);
+                check_fixed_chars(T{-1}, base);
+                check_fixed_chars(xstd::numeric_limits<T>::min(), base);
+                check_fixed_chars(xstd::numeric_limits<T>::max(), base);
+        }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(MatchesToCharsUnsigned, T, xstd::test::exact_width_unsigned_integer_types)
+{
+        for (auto base = 2; base <= 36; ++base) {
+                check_fixed_chars(T{0}, base);
+                check_fixed_chars(T{1}, base);
+                check_fixed_chars(xstd::numeric_limits<T>::max(), base);
+        }
+}
+
+// The use it is for: a table of wide renderings, computed in full before the program runs.
+BOOST_AUTO_TEST_CASE(ConstantTable)
+{
+        constexpr auto table = std::array{
+                xstd::to_fixed_chars(xstd::numeric_limits<xstd::int128>::min()),
+                xstd::to_fixed_chars(xstd::int128{0}),
+                xstd::to_fixed_chars(xstd::numeric_limits<xstd::int128>::max())
+        };
+        static_assert(table[0].view() == "-170141183460469231731687303715884105728");
+        static_assert(table[1].view() == "0");
+        static_assert(table[2].view() == "170141183460469231731687303715884105727");
+        static_assert(xstd::to_fixed_chars(xstd::numeric_limits<xstd::uint128>::max(), 16).view() == "ffffffffffffffffffffffffffffffff");
+        static_assert(xstd::to_fixed_chars(-42).view() == "-42");
+        static_assert(xstd::to_fixed_chars(255U, 2) == xstd::to_fixed_chars(255U, 2));
+        BOOST_CHECK(table[1] != table[2]);
+        BOOST_CHECK_EQUAL(std::string_view{table[1]}, "0");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,41 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Preconditions only, before anything includes contracts.hpp: this executable is the one that tests that level.
+#define XSTD_CHECK_LEVEL 1
+
+#include <xstd/contracts.hpp>                       // XSTD_AUDIT, XSTD_PRECONDITION
+#include <xstd/cstdlib/div.hpp>                     // div
+#include <xstd/test/boost_test_print_log_value.hpp> // NOLINT(misc-include-cleaner): registers Boost.Test printers
+#include <xstd/test/constexpr_check.hpp>            // XSTD_CONSTEXPR_CHECK_EQUAL
+#include <boost/test/unit_test.hpp>                 // BOOST_AUTO_TEST_CASE, BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_CHECK_EQUAL
+
+BOOST_AUTO_TEST_SUITE(Contracts)
+
+// A precondition is evaluated, where assert is, and an audit is not, yet still compiled.
+BOOST_AUTO_TEST_CASE(PreconditionLevel)
+{
+        auto evaluated = 0;
+        auto const check = [&] {
+                ++evaluated;
+                return true;
+        };
+        XSTD_PRECONDITION(check());
+        XSTD_AUDIT(check());
+#ifdef NDEBUG
+        BOOST_CHECK_EQUAL(evaluated, 0);
+#else
+        BOOST_CHECK_EQUAL(evaluated, 1);
+#endif
+}
+
+// The division family keeps working, in constant evaluation too, with its postconditions left out.
+BOOST_AUTO_TEST_CASE(DivisionAtPreconditionLevel)
+{
+        XSTD_CONSTEXPR_CHECK_EQUAL(xstd::div(-8, 3), (xstd::div_result<int>{-2, -2}));
+        XSTD_CONSTEXPR_CHECK_EQUAL(xstd::div(8U, 3U), (xstd::div_result<unsigned>{2, 2}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
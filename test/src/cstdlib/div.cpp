@@ -3,12 +3,14 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          http://www.boost.org/LICENSE_1_0.txt)
 
+#include <xstd/cstdint/int128.hpp>                  // int128, uint128
 #include <xstd/cstdlib/div.hpp>                     // div
 #include <xstd/test/constexpr_check.hpp>            // XSTD_CONSTEXPR_CHECK, XSTD_CONSTEXPR_CHECK_EQUAL
 #include <xstd/test/boost_test_print_log_value.hpp> // NOLINT(misc-include-cleaner): registers Boost.Test printers
 #include <xstd/test/exact_width_types.hpp>          // exact_width_signed_integer_types, exact_width_unsigned_integer_types
 #include <xstd/limits.hpp>                          // numeric_limits
 #include <boost/test/unit_test.hpp>                 // Boost.Test
+#include <cstddef>                                  // size_t
 
 BOOST_AUTO_TEST_SUITE(CStdLib)
 
@@ -38,4 +40,27 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(TruncatedDivUnsigned, T, xstd::test::exact_width_u
         XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::div(limits::max(), limits::max())), (xstd::div_result<T>{1, 0}));
 }
 
+// At run time the 128-bit types divide by a denominator below 2^64 in 64-bit steps: checked against / and %.
+BOOST_AUTO_TEST_CASE(NarrowDenominator)
+{
+        using U = xstd::uint128;
+        using I = xstd::int128;
+        auto const word = std::size_t{64};
+        auto const wide = static_cast<U>(static_cast<U>(U{0x0123'4567'89ab'cdef} << word) | U{0xfedc'ba98'7654'3210});
+        for (auto const numer : {U{0}, U{1}, U{0xffff'ffff'ffff'ffff}, static_cast<U>(U{1} << word), wide, xstd::numeric_limits<U>::max()}) {
+                for (auto const denom : {U{1}, U{3}, U{10}, U{10'000'000'000'000'000'000U}, U{0xffff'ffff'ffff'ffff}, static_cast<U>(U{1} << word), static_cast<U>(wide >> std::size_t{3})}) {
+                        BOOST_CHECK_EQUAL(xstd::div(numer, denom), (xstd::div_result<U>{static_cast<U>(numer / denom), static_cast<U>(numer % denom)}));
+
+                        // Every sign combination of the same magnitudes, none of them MIN.
+                        auto const n = static_cast<I>(numer >> std::size_t{1});
+                        auto const d = static_cast<I>(denom);
+                        for (auto const sn : {n, static_cast<I>(-n)}) {
+                                for (auto const sd : {d, static_cast<I>(-d)}) {
+                                        BOOST_CHECK_EQUAL(xstd::div(sn, sd), (xstd::div_result<I>{static_cast<I>(sn / sd), static_cast<I>(sn % sd)}));
+                                }
+                        }
+                }
+        }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
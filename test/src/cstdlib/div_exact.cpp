@@ -0,0 +1,60 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/cstdlib/div_exact.hpp>               // div_exact, exact_divider, is_divisible
+#include <xstd/cstdlib/div.hpp>                     // div
+#include <xstd/limits.hpp>                          // numeric_limits
+#include <xstd/test/constexpr_check.hpp>            // XSTD_CONSTEXPR_CHECK, XSTD_CONSTEXPR_CHECK_EQUAL_IF
+#include <xstd/test/boost_test_print_log_value.hpp> // NOLINT(misc-include-cleaner): registers Boost.Test printers
+#include <xstd/test/exact_width_types.hpp>          // exact_width_integer_types, exact_width_signed_integer_types, exact_width_unsigned_integer_types
+#include <xstd/test/samples.hpp>                    // samples
+#include <xstd/type_traits/is_signed.hpp>           // is_signed_v
+#include <boost/test/unit_test.hpp>                 // Boost.Test
+
+BOOST_AUTO_TEST_SUITE(CStdLib)
+
+// is_divisible, either form, against div's remainder; div_exact, either form, against its quotient.
+BOOST_AUTO_TEST_CASE_TEMPLATE(ExactDiv, T, xstd::test::exact_width_integer_types)
+{
+        auto const values = xstd::test::samples<T>();
+        for (auto const d : values) {
+                if (d == T{0}) {
+                        continue;
+                }
+                auto const divider = xstd::exact_divider<T>(d);
+                for (auto const n : values) {
+                        if constexpr (xstd::is_signed_v<T>) {
+                                if (n == xstd::numeric_limits<T>::min() and d == T{-1}) {
+                                        continue;
+                                }
+                        }
+                        auto const [quotient, remainder] = xstd::div(n, d);
+                        auto const divisible = remainder == T{0};
+                        BOOST_CHECK_EQUAL(xstd::is_divisible(n, d), divisible);
+                        BOOST_CHECK_EQUAL(xstd::is_divisible(n, divider), divisible);
+                        if (divisible) {
+                                BOOST_CHECK_EQUAL(xstd::div_exact(n, d), quotient);
+                                BOOST_CHECK_EQUAL(xstd::div_exact(n, divider), quotient);
+                        }
+                }
+        }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ExactDivSigned, T, xstd::test::exact_width_signed_integer_types)
+{
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::div_exact(T{-84}, T{+12})), T{-7});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::div_exact(T{+84}, xstd::exact_divider(T{-12}))), T{-7});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::is_divisible(T{-84}, xstd::exact_divider(T{-12}))), true);
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::is_divisible(T{-86}, xstd::exact_divider(T{+12}))), false);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ExactDivUnsigned, T, xstd::test::exact_width_unsigned_integer_types)
+{
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::div_exact(T{84}, T{12})), T{7});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::is_divisible(T{90}, xstd::exact_divider(T{12}))), false);
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::is_divisible(xstd::numeric_limits<T>::max(), xstd::exact_divider(T{3}))), true);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,111 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/cstdlib/div_span.hpp>                // div, div_euclid, div_floor
+#include <xstd/cstdlib/div.hpp>                     // div
+#include <xstd/cstdlib/div_euclid.hpp>              // div_euclid
+#include <xstd/cstdlib/div_floor.hpp>               // div_floor
+#include <xstd/cstdlib/div_result.hpp>              // div_result
+#include <xstd/limits.hpp>                          // numeric_limits
+#include <xstd/test/boost_test_print_log_value.hpp> // NOLINT(misc-include-cleaner): registers Boost.Test printers
+#include <xstd/test/exact_width_types.hpp>          // exact_width_integer_types
+#include <xstd/test/samples.hpp>                    // samples
+#include <xstd/type_traits/is_signed.hpp>           // is_signed_v
+#include <boost/test/unit_test.hpp>                 // Boost.Test
+#include <array>                                    // array
+#include <cstddef>                                  // size_t
+#include <span>                                     // span
+#include <vector>                                   // vector
+
+BOOST_AUTO_TEST_SUITE(CStdLib)
+
+namespace {
+
+// Each form against the scalar function, element by element.
+template<class T, class Elementwise, class Scalar>
+auto check(Elementwise elementwise, Scalar scalar)
+        -> void
+{
+        auto const values = xstd::test::samples<T>();
+        for (auto const d : values) {
+                if (d == T{0}) {
+                        continue;
+                }
+                // The numerators the contract allows against this denominator.
+                auto numer = std::vector<T>{};
+                for (auto const n : values) {
+                        if constexpr (xstd::is_signed_v<T>) {
+                                if (n == xstd::numeric_limits<T>::min() and d == T{-1}) {
+                                        continue;
+                                }
+                        }
+                        numer.push_back(n);
+                }
+                auto const denom = std::vector<T>(numer.size(), d);
+                auto quotient = std::vector<T>(numer.size());
+                auto remainder = std::vector<T>(numer.size());
+                auto result = std::vector<xstd::div_result<T>>(numer.size());
+                auto quotient_each = std::vector<T>(numer.size());
+                auto remainder_each = std::vector<T>(numer.size());
+                auto result_each = std::vector<xstd::div_result<T>>(numer.size());
+                elementwise(std::span(numer), d, quotient, remainder);
+                elementwise(std::span(numer), d, result);
+                elementwise(std::span(numer), denom, quotient_each, remainder_each);
+                elementwise(std::span(numer), denom, result_each);
+                for (auto i = std::size_t{0}; i != numer.size(); ++i) {
+                        auto const expected = scalar(numer[i], d);
+                        BOOST_CHECK_EQUAL((xstd::div_result<T>{quotient[i], remainder[i]}), expected);
+                        BOOST_CHECK_EQUAL(result[i], expected);
+                        BOOST_CHECK_EQUAL((xstd::div_result<T>{quotient_each[i], remainder_each[i]}), expected);
+                        BOOST_CHECK_EQUAL(result_each[i], expected);
+                }
+        }
+}
+
+// Whether a span of int numerators can be floor divided by a D.
+template<class D>
+concept floors_ints_by = requires (std::span<int const> numer, D const& denom, std::span<int> quotient, std::span<int> remainder) {
+        xstd::div_floor(numer, denom, quotient, remainder);
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ElementwiseDiv, T, xstd::test::exact_width_integer_types)
+{
+        check<T>([](auto&&... args) { xstd::div(args...); }, [](T n, T d) { return xstd::div(n, d); });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ElementwiseDivFloor, T, xstd::test::exact_width_integer_types)
+{
+        check<T>([](auto&&... args) { xstd::div_floor(args...); }, [](T n, T d) { return xstd::div_floor(n, d); });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ElementwiseDivEuclid, T, xstd::test::exact_width_integer_types)
+{
+        check<T>([](auto&&... args) { xstd::div_euclid(args...); }, [](T n, T d) { return xstd::div_euclid(n, d); });
+}
+
+// A shared denominator of the numerators' own type only: nothing that would be converted to it on the way in.
+BOOST_AUTO_TEST_CASE(ElementwiseDenominatorTypes)
+{
+        static_assert(floors_ints_by<int> and floors_ints_by<int const> and floors_ints_by<std::vector<int>> and floors_ints_by<std::array<int, 4>>);
+        static_assert(not floors_ints_by<double> and not floors_ints_by<long long> and not floors_ints_by<short> and not floors_ints_by<std::vector<long>>);
+}
+
+// Read-only numerators, a fixed extent, and a constant evaluation.
+BOOST_AUTO_TEST_CASE(ElementwiseConstexpr)
+{
+        constexpr auto floored = [] {
+                constexpr auto numer = std::array{-8, -1, 0, 7};
+                auto quotient = std::array<int, 4>{};
+                auto remainder = std::array<int, 4>{};
+                xstd::div_floor(std::span(numer), 3, quotient, remainder);
+                return quotient[0] == -3 and remainder[0] == 1 and quotient[1] == -1 and remainder[1] == 2 and quotient[3] == 2 and remainder[3] == 1;
+        };
+        static_assert(floored());
+        BOOST_CHECK(floored());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,108 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/cstdlib/divider.hpp>                 // divider, div, div_euclid, div_floor
+#include <xstd/cstdlib/div.hpp>                     // div
+#include <xstd/cstdlib/div_euclid.hpp>              // div_euclid
+#include <xstd/cstdlib/div_floor.hpp>               // div_floor
+#include <xstd/limits.hpp>                          // numeric_limits
+#include <xstd/test/constexpr_check.hpp>            // XSTD_CONSTEXPR_CHECK_EQUAL_IF
+#include <xstd/test/boost_test_print_log_value.hpp> // NOLINT(misc-include-cleaner): registers Boost.Test printers
+#include <xstd/test/exact_width_types.hpp>          // exact_width_signed_integer_types, exact_width_unsigned_integer_types
+#include <xstd/test/samples.hpp>                    // samples
+#include <xstd/type_traits/is_signed.hpp>           // is_signed_v
+#include <boost/test/unit_test.hpp>                 // Boost.Test
+
+BOOST_AUTO_TEST_SUITE(CStdLib)
+
+namespace {
+
+// Every pair of samples the contract allows, by the divider against the scalar function.
+template<class T>
+auto check_against_scalar()
+        -> void
+{
+        auto const values = xstd::test::samples<T>();
+        for (auto const d : values) {
+                if (d == T{0}) {
+                        continue;
+                }
+                auto const divider = xstd::divider<T>(d);
+                for (auto const n : values) {
+                        if constexpr (xstd::is_signed_v<T>) {
+                                if (n == xstd::numeric_limits<T>::min() and d == T{-1}) {
+                                        continue;
+                                }
+                        }
+                        BOOST_CHECK_EQUAL(xstd::div(n, divider), xstd::div(n, d));
+                        BOOST_CHECK_EQUAL(xstd::div_floor(n, divider), xstd::div_floor(n, d));
+                        BOOST_CHECK_EQUAL(xstd::div_euclid(n, divider), xstd::div_euclid(n, d));
+                }
+        }
+}
+
+// Every sample by the constant D, against the scalar functions with D passed at run time.
+template<class T, auto D>
+auto check_constant()
+        -> void
+{
+        for (auto const n : xstd::test::samples<T>()) {
+                if constexpr (xstd::is_signed_v<T> and D == -1) {
+                        if (n == xstd::numeric_limits<T>::min()) {
+                                continue;
+                        }
+                }
+                BOOST_CHECK_EQUAL(xstd::div<D>(n), xstd::div(n, static_cast<T>(D)));
+                BOOST_CHECK_EQUAL(xstd::div_floor<D>(n), xstd::div_floor(n, static_cast<T>(D)));
+                BOOST_CHECK_EQUAL(xstd::div_euclid<D>(n), xstd::div_euclid(n, static_cast<T>(D)));
+        }
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(DividerSigned, T, xstd::test::exact_width_signed_integer_types)
+{
+        check_against_scalar<T>();
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::div(T{-8}, xstd::divider(T{+3}))), (xstd::div_result<T>{-2, -2}));
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::div_floor(T{+8}, xstd::divider(T{-3}))), (xstd::div_result<T>{-3, -1}));
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::div_euclid(T{-8}, xstd::divider(T{-3}))), (xstd::div_result<T>{+3, +1}));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(DividerUnsigned, T, xstd::test::exact_width_unsigned_integer_types)
+{
+        check_against_scalar<T>();
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::div(T{100}, xstd::divider(T{7}))), (xstd::div_result<T>{14, 2}));
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::div(T{100}, xstd::divider(T{8}))), (xstd::div_result<T>{12, 4}));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ConstantSigned, T, xstd::test::exact_width_signed_integer_types)
+{
+        check_constant<T, 1>();
+        check_constant<T, -1>();
+        check_constant<T, 3>();
+        check_constant<T, -3>();
+        check_constant<T, 8>();
+        check_constant<T, -8>();
+        check_constant<T, 10>();
+        check_constant<T, 60>();
+        check_constant<T, -100>();
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::div<3>(T{-8})), (xstd::div_result<T>{-2, -2}));
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::div_floor<4>(T{-9})), (xstd::div_result<T>{-3, +3}));
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::div_euclid<-3>(T{-8})), (xstd::div_result<T>{+3, +1}));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ConstantUnsigned, T, xstd::test::exact_width_unsigned_integer_types)
+{
+        check_constant<T, 1U>();
+        check_constant<T, 3U>();
+        check_constant<T, 8U>();
+        check_constant<T, 10U>();
+        check_constant<T, 60U>();
+        check_constant<T, 128U>();
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::div<7U>(T{100})), (xstd::div_result<T>{14, 2}));
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::div_floor<16U>(T{100})), (xstd::div_result<T>{6, 4}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,52 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/cstdlib/rem_euclid.hpp>              // rem_euclid
+#include <xstd/limits.hpp>                          // numeric_limits
+#include <xstd/test/constexpr_check.hpp>            // XSTD_CONSTEXPR_CHECK_EQUAL_IF
+#include <xstd/test/boost_test_print_log_value.hpp> // NOLINT(misc-include-cleaner): registers Boost.Test printers
+#include <xstd/test/exact_width_types.hpp>          // exact_width_signed_integer_types, exact_width_unsigned_integer_types
+#include <boost/test/unit_test.hpp>                 // Boost.Test
+
+BOOST_AUTO_TEST_SUITE(CStdLib)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(EuclideanRem, T, xstd::test::exact_width_signed_integer_types)
+{
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid(T{+8}, T{+3})), T{+2});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid(T{+8}, T{-3})), T{+2});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid(T{-8}, T{+3})), T{+1});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid(T{-8}, T{-3})), T{+1});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid(T{+1}, T{+2})), T{+1});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid(T{+1}, T{-2})), T{+1});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid(T{-1}, T{+2})), T{+1});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid(T{-1}, T{-2})), T{+1});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid<1>(xstd::numeric_limits<T>::min())), T{0});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid<-1>(xstd::numeric_limits<T>::max())), T{0});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid<3>(T{-8})), T{+1});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid<-3>(T{-8})), T{+1});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid<8>(xstd::numeric_limits<T>::min())), T{0});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid<8>(xstd::numeric_limits<T>::max())), T{+7});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid<-8>(xstd::numeric_limits<T>::min())), T{0});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid<-8>(xstd::numeric_limits<T>::max())), T{+7});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid<10>(T{-1})), T{+9});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid<16>(T{-1})), T{+15});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid<-16>(T{+1})), T{+1});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid<-60>(T{-1})), T{+59});
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(EuclideanRemUnsigned, T, xstd::test::exact_width_unsigned_integer_types)
+{
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid(T{8}, T{3})), T{2});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid(T{1}, T{2})), T{1});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid(T{0}, T{3})), T{0});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid<1U>(xstd::numeric_limits<T>::max())), T{0});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid<3U>(xstd::numeric_limits<T>::max())), T{0});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid<8U>(xstd::numeric_limits<T>::max())), T{7});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid<10U>(T{99})), T{9});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid<16U>(xstd::numeric_limits<T>::max())), T{15});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::rem_euclid<60U>(T{100})), T{40});
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -51,4 +51,12 @@ BOOST_AUTO_TEST_CASE(WideFormatter)
         BOOST_CHECK(std::format(L"{}", xstd::div_result<int>{1, -2}) == std::wstring_view{L"(1, -2)"});
 }
 
+// Widened before the base pads it, and written straight out when there is nothing to pad.
+BOOST_AUTO_TEST_CASE(WideFillAndAlign)
+{
+        BOOST_CHECK(std::format(L"{:*>9}", xstd::div_result<int>{1, -2}) == std::wstring_view{L"**(1, -2)"});
+        BOOST_CHECK(std::format(L"{}", xstd::div_result<xstd::int128>{std::numeric_limits<xstd::int128>::min(), 7}) ==
+                    std::wstring_view{L"(-170141183460469231731687303715884105728, 7)"});
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,82 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/cstdint.hpp>                  // int128, uint128
+#include <xstd/format/formatted_integer.hpp> // formatted_integer, formatter<formatted_integer>
+#include <xstd/test/exact_width_types.hpp>   // std_signed_types
+#include <boost/test/unit_test.hpp>          // BOOST_AUTO_TEST_CASE, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_CHECK, BOOST_CHECK_EQUAL, BOOST_CHECK_THROW
+#include <array>                             // array
+#include <format>                            // format, format_error, make_format_args, vformat
+#include <limits>                            // numeric_limits
+#include <string_view>                       // string_view, wstring_view
+#include <type_traits>                       // make_unsigned_t
+
+BOOST_AUTO_TEST_SUITE(FormatFormattedInteger)
+
+// Every flag, on its own and combined, against the library's own rendering of the same value.
+BOOST_AUTO_TEST_CASE_TEMPLATE(MatchesTheStandardGrammar, T, xstd::test::std_signed_types)
+{
+        using U = std::make_unsigned_t<T>;
+        constexpr auto specs = std::array<std::string_view, 16>{
+                "{}", "{:+}", "{: }", "{:#b}", "{:#B}", "{:#o}", "{:#x}", "{:#X}",
+                "{:8}", "{:<8}", "{:^8}", "{:*>8}", "{:08}", "{:#012x}", "{:>08}", "{:+#06o}"
+        };
+        auto const values = std::array<T, 6>{T{0}, T{1}, T{-1}, T{42}, std::numeric_limits<T>::min(), std::numeric_limits<T>::max()};
+        for (auto const spec : specs) {
+                for (auto const value : values) {
+                        auto const wrapped = xstd::formatted_integer{value};
+                        BOOST_CHECK_EQUAL(std::vformat(spec, std::make_format_args(wrapped)), std::vformat(spec, std::make_format_args(value)));
+                        auto const magnitude = static_cast<U>(value);
+                        auto const wrapped_magnitude = xstd::formatted_integer{magnitude};
+                        BOOST_CHECK_EQUAL(std::vformat(spec, std::make_format_args(wrapped_magnitude)), std::vformat(spec, std::make_format_args(magnitude)));
+                }
+        }
+}
+
+// The types the wrapper is for, at the extremes the library cannot reach.
+BOOST_AUTO_TEST_CASE(Wide)
+{
+        BOOST_CHECK_EQUAL(std::format("{}", xstd::formatted_integer{std::numeric_limits<xstd::int128>::min()}),
+                          "-170141183460469231731687303715884105728");
+        BOOST_CHECK_EQUAL(std::format("{:#X}", xstd::formatted_integer{std::numeric_limits<xstd::uint128>::max()}),
+                          "0XFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF");
+        BOOST_CHECK_EQUAL(std::format("{:_^44}", xstd::formatted_integer{std::numeric_limits<xstd::int128>::max()}),
+                          "__170141183460469231731687303715884105727___");
+        BOOST_CHECK_EQUAL(std::format("{:+#036b}", xstd::formatted_integer{xstd::int128{1} << 32}),
+                          "+0b100000000000000000000000000000000");
+        BOOST_CHECK(std::format(L"{:#x}", xstd::formatted_integer{xstd::uint128{255}}) == std::wstring_view{L"0xff"});
+}
+
+// An empty spec followed by text that looks like an alignment: the closing brace is not a fill.
+BOOST_AUTO_TEST_CASE(EmptySpecBeforeAlignment)
+{
+        auto const value = xstd::formatted_integer{xstd::int128{42}};
+        BOOST_CHECK_EQUAL(std::format("{}>", value), "42>");
+        BOOST_CHECK_EQUAL(std::format("{}<{}^", value, value), "42<42^");
+        BOOST_CHECK_EQUAL(std::format("{:}>", value), "42>");
+        BOOST_CHECK_EQUAL(std::vformat("{}>", std::make_format_args(value)), "42>");
+}
+
+// A fill is a code point, however many code units it takes, and a wide one counts once toward the width.
+BOOST_AUTO_TEST_CASE(MultiByteFill)
+{
+        auto const value = xstd::formatted_integer{xstd::int128{42}};
+        BOOST_CHECK_EQUAL(std::format("{:\u20AC>6}", value), "\u20AC\u20AC\u20AC\u20AC42");
+        BOOST_CHECK_EQUAL(std::format("{:\U0001F600^6}", value), "\U0001F600\U0001F60042\U0001F600\U0001F600");
+        BOOST_CHECK(std::format(L"{:\u20AC<4}", value) == std::wstring_view{L"42\u20AC\u20AC"});
+        BOOST_CHECK_THROW(static_cast<void>(std::vformat("{:\u20ACx}", std::make_format_args(value))), std::format_error);
+}
+
+// What the integer grammar has but this wrapper does not is refused, not ignored.
+BOOST_AUTO_TEST_CASE(Rejected)
+{
+        auto const value = xstd::formatted_integer{xstd::int128{1}};
+        auto const width = 4;
+        BOOST_CHECK_THROW(static_cast<void>(std::vformat("{:c}", std::make_format_args(value))), std::format_error);
+        BOOST_CHECK_THROW(static_cast<void>(std::vformat("{:L}", std::make_format_args(value))), std::format_error);
+        BOOST_CHECK_THROW(static_cast<void>(std::vformat("{:{}}", std::make_format_args(value, width))), std::format_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
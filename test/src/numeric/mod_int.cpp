@@ -0,0 +1,164 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/numeric/mod_int.hpp>                  // div, mod_int, sign, to_chars
+#include <xstd/charconv/to_chars.hpp>                // to_chars, to_chars_max_size
+#include <xstd/concepts/integer.hpp>                 // integer
+#include <xstd/concepts/unsigned_integer.hpp>        // unsigned_integer
+#include <xstd/cstdint/int128.hpp>                   // uint128
+#include <xstd/cstdlib/div.hpp>                      // div
+#include <xstd/cstdlib/div_result.hpp>               // div_result
+#include <xstd/cstdlib/sign.hpp>                     // sign
+#include <xstd/limits.hpp>                           // numeric_limits
+#include <xstd/numeric/modulus.hpp>                  // modulus
+#include <xstd/test/constexpr_check.hpp>             // XSTD_CONSTEXPR_CHECK_EQUAL
+#include <xstd/test/boost_test_print_log_value.hpp>  // print_integer
+#include <boost/test/unit_test.hpp>                  // Boost.Test
+#include <algorithm>                                 // equal
+#include <array>                                     // array
+#include <cstdint>                                   // uint8_t, uint16_t, uint32_t, uint64_t
+#include <ostream>                                   // ostream
+#include <string_view>                               // string_view
+#include <tuple>                                     // tuple
+#include <vector>                                    // vector
+
+namespace boost::test_tools::tt_detail {
+
+template<xstd::unsigned_integer I, I M>
+struct print_log_value<xstd::mod_int<I, M>>
+{
+        auto operator()(std::ostream& ostr, xstd::mod_int<I, M> const value) const -> void
+        {
+                xstd::test::print_integer(ostr, value.residue());
+        }
+};
+
+} // namespace boost::test_tools::tt_detail
+
+BOOST_AUTO_TEST_SUITE(Numeric)
+
+namespace {
+
+using angle = xstd::mod_int<std::uint16_t, 360>;
+
+// Moduli whose sums fit their type and ones whose do not, likewise for products, and one not a built-in's width. And
+// powers of ten, below which the residues' bit width reaches a power of ten that M itself does not exceed.
+using mod_int_types = std::tuple<
+        xstd::mod_int<std::uint8_t, 7>,
+        xstd::mod_int<std::uint8_t, 200>,
+        angle,
+        xstd::mod_int<std::uint32_t, 1'000>,
+        xstd::mod_int<std::uint32_t, 4'000'000'007>,
+        xstd::mod_int<std::uint64_t, 10'000'000'000'000'000'000U>,
+        xstd::mod_int<std::uint64_t, (std::uint64_t{1} << 61U) - 1U>,
+        xstd::mod_int<xstd::uint128, (xstd::uint128{1} << 100U) + 277U>
+>;
+
+template<class T>
+using rep = decltype(T{}.residue());
+
+// M - 1, the largest residue.
+template<class T>
+constexpr auto last = (-T{1}).residue();
+
+// Both ends, the middle, and a few in between.
+template<class T>
+auto residues()
+        -> std::vector<T>
+{
+        using I = rep<T>;
+        auto values = std::vector<T>{};
+        for (auto const r : {I{0}, I{1}, I{2}, static_cast<I>(last<T> / I{3}), static_cast<I>(last<T> / I{2}), static_cast<I>(last<T> - I{1}), last<T>}) {
+                values.emplace_back(r);
+        }
+        return values;
+}
+
+} // namespace
+
+// Not an integer: the generic kernels would build their constants in it, wrapping at M where they expect 2^N.
+BOOST_AUTO_TEST_CASE_TEMPLATE(ModIntIsNotAnInteger, T, mod_int_types)
+{
+        static_assert(not xstd::integer<T>);
+        static_assert(not xstd::numeric_limits<T>::is_specialized);
+        static_assert(noexcept(T{} + T{}) and noexcept(T{} * T{}) and noexcept(T{} / T{1}));
+}
+
+// +, - and * against modulus at run time, / and % against the residues' own.
+BOOST_AUTO_TEST_CASE_TEMPLATE(ModIntArithmetic, T, mod_int_types)
+{
+        using I = rep<T>;
+        auto const m = xstd::modulus<I>(static_cast<I>(last<T> + I{1}));
+        for (auto const a : residues<T>()) {
+                BOOST_CHECK_EQUAL((a + -a), T{0});
+                for (auto const b : residues<T>()) {
+                        BOOST_CHECK_EQUAL((a + b).residue(), m.add_mod(a.residue(), b.residue()));
+                        BOOST_CHECK_EQUAL((a - b).residue(), m.sub_mod(a.residue(), b.residue()));
+                        BOOST_CHECK_EQUAL((a * b).residue(), m.mul_mod(a.residue(), b.residue()));
+                        if (b != T{0}) {
+                                BOOST_CHECK_EQUAL((a / b).residue(), static_cast<I>(a.residue() / b.residue()));
+                                BOOST_CHECK_EQUAL((a % b).residue(), static_cast<I>(a.residue() % b.residue()));
+                                BOOST_CHECK_EQUAL(((a / b) * b + a % b), a);
+                        }
+                }
+        }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ModIntConversions, T, mod_int_types)
+{
+        using I = rep<T>;
+        auto const max = T{last<T>};
+        BOOST_CHECK_EQUAL(T{-1}, max);
+        BOOST_CHECK_EQUAL(T{-1} + T{1}, T{0});
+        BOOST_CHECK_EQUAL(static_cast<I>(max), last<T>);
+        BOOST_CHECK_EQUAL(T{xstd::numeric_limits<std::uint64_t>::max()}.residue(), static_cast<I>(xstd::numeric_limits<std::uint64_t>::max() % (last<T> + I{1})));
+        BOOST_CHECK(not T{});
+        BOOST_CHECK(static_cast<bool>(T{1}));
+
+        auto x = max;
+        BOOST_CHECK_EQUAL(++x, T{0});
+        BOOST_CHECK_EQUAL(x--, T{0});
+        BOOST_CHECK_EQUAL(x, max);
+}
+
+// div, sign and to_chars, overloaded for mod_int, against the same functions on the residues.
+BOOST_AUTO_TEST_CASE_TEMPLATE(ModIntIntegerFunctions, T, mod_int_types)
+{
+        using I = rep<T>;
+        for (auto const a : residues<T>()) {
+                BOOST_CHECK_EQUAL(xstd::sign(a), a == T{0} ? 0 : 1);
+                for (auto const b : residues<T>()) {
+                        if (b != T{0}) {
+                                auto const [quotient, remainder] = xstd::div(a, b);
+                                BOOST_CHECK_EQUAL(T{quotient}, a / b);
+                                BOOST_CHECK_EQUAL(T{remainder}, a % b);
+                        }
+                }
+                auto buffer = std::array<char, xstd::to_chars_max_size<I>>{};
+                auto wide = std::array<wchar_t, xstd::to_chars_max_size<I>>{};
+                auto expected = std::array<char, xstd::to_chars_max_size<I>>{};
+                for (auto const base : {2, 10, 36}) {
+                        auto const result = xstd::to_chars(buffer.data(), buffer.data() + buffer.size(), a, base);
+                        auto const wide_result = xstd::to_chars(wide.data(), wide.data() + wide.size(), a, base);
+                        auto const reference = xstd::to_chars(expected.data(), expected.data() + expected.size(), a.residue(), base);
+                        BOOST_CHECK_EQUAL(std::string_view(buffer.data(), result.ptr), std::string_view(expected.data(), reference.ptr));
+                        BOOST_CHECK(std::equal(wide.data(), wide_result.ptr, expected.data(), reference.ptr, [](wchar_t w, char c) { return w == static_cast<wchar_t>(c); }));
+                }
+        }
+}
+
+// An angle in degrees: a full turn is no turn, and a quadrant is a division.
+BOOST_AUTO_TEST_CASE(ModIntAngle)
+{
+        XSTD_CONSTEXPR_CHECK_EQUAL(angle{350} + angle{20}, angle{10});
+        XSTD_CONSTEXPR_CHECK_EQUAL(angle{10} - angle{20}, angle{350});
+        XSTD_CONSTEXPR_CHECK_EQUAL(angle{-90}, angle{270});
+        XSTD_CONSTEXPR_CHECK_EQUAL(angle{45} * angle{9}, angle{45});
+        XSTD_CONSTEXPR_CHECK_EQUAL(angle{1000}, angle{280});
+        XSTD_CONSTEXPR_CHECK_EQUAL(xstd::div(angle{280}, angle{90}), (xstd::div_result<std::uint16_t>{3, 10}));
+        XSTD_CONSTEXPR_CHECK_EQUAL(xstd::sign(angle{360}), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
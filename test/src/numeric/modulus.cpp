@@ -0,0 +1,114 @@
+//          Copyright Rein Halbersma 2014-2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/numeric/modulus.hpp>                 // modulus
+#include <xstd/cstdlib/div.hpp>                     // div
+#include <xstd/limits.hpp>                          // numeric_limits
+#include <xstd/test/constexpr_check.hpp>            // XSTD_CONSTEXPR_CHECK_EQUAL_IF
+#include <xstd/test/boost_test_print_log_value.hpp> // NOLINT(misc-include-cleaner): registers Boost.Test printers
+#include <xstd/test/exact_width_types.hpp>          // exact_width_unsigned_integer_types, has_constexpr_division
+#include <xstd/test/samples.hpp>                    // samples
+#include <boost/test/unit_test.hpp>                 // Boost.Test
+#include <cstddef>                                  // size_t
+#include <vector>                                   // vector
+
+BOOST_AUTO_TEST_SUITE(Numeric)
+
+namespace {
+
+// a + b mod m, for residues, without overflowing.
+template<class T>
+auto reference_add(T a, T b, T m)
+        -> T
+{
+        return a >= static_cast<T>(m - b) ? static_cast<T>(a - static_cast<T>(m - b)) : static_cast<T>(a + b);
+}
+
+// a * b mod m, for residues, by doubling and adding: no product wider than T.
+template<class T>
+auto reference_mul(T a, T b, T m)
+        -> T
+{
+        auto result = T{0};
+        for (auto bit = xstd::numeric_limits<T>::digits; bit-- != 0;) {
+                result = reference_add(result, result, m);
+                if (static_cast<T>(static_cast<T>(b >> static_cast<std::size_t>(bit)) & T{1}) != T{0}) {
+                        result = reference_add(result, a, m);
+                }
+        }
+        return result;
+}
+
+} // namespace
+
+// Each operation against division, and against the reference arithmetic above.
+BOOST_AUTO_TEST_CASE_TEMPLATE(Modulus, T, xstd::test::exact_width_unsigned_integer_types)
+{
+        auto const values = xstd::test::samples<T>();
+        for (auto const m : values) {
+                if (m == T{0}) {
+                        continue;
+                }
+                auto const mod = xstd::modulus<T>(m);
+                BOOST_CHECK_EQUAL(mod.value(), m);
+                for (auto const x : values) {
+                        BOOST_CHECK_EQUAL(mod.reduce(x), xstd::div(x, m).remainder);
+                }
+                // The residues at both ends, the middle, and two of all the widths up to m's.
+                auto const residues = std::vector<T>{
+                        T{0}, static_cast<T>(T{1} % m), static_cast<T>(m / T{2}), static_cast<T>(m - T{1}),
+                        mod.reduce(xstd::numeric_limits<T>::max()), mod.reduce(static_cast<T>(xstd::numeric_limits<T>::max() / T{3}))
+                };
+                auto const odd = static_cast<T>(m & T{1}) != T{0};
+                for (auto const a : residues) {
+                        if (odd) {
+                                BOOST_CHECK_EQUAL(mod.from_montgomery(mod.to_montgomery(a)), a);
+                        }
+                        for (auto const b : residues) {
+                                auto const sum = reference_add(a, b, m);
+                                auto const product = reference_mul(a, b, m);
+                                BOOST_CHECK_EQUAL(mod.add_mod(a, b), sum);
+                                BOOST_CHECK_EQUAL(mod.sub_mod(sum, b), a);
+                                BOOST_CHECK_EQUAL(mod.mul_mod(a, b), product);
+                                if (odd) {
+                                        BOOST_CHECK_EQUAL(mod.from_montgomery(mod.montgomery_mul(mod.to_montgomery(a), mod.to_montgomery(b))), product);
+                                }
+                        }
+                }
+        }
+}
+
+// pow_mod against repeated multiplication, odd and even moduli alike, and Fermat's little theorem for a prime.
+BOOST_AUTO_TEST_CASE_TEMPLATE(PowMod, T, xstd::test::exact_width_unsigned_integer_types)
+{
+        for (auto const m : xstd::test::samples<T>()) {
+                if (m == T{0}) {
+                        continue;
+                }
+                auto const mod = xstd::modulus<T>(m);
+                for (auto const base : {T{0}, T{2}, T{3}, xstd::numeric_limits<T>::max()}) {
+                        auto expected = mod.reduce(T{1});
+                        for (auto exponent = 0U; exponent != 40U; ++exponent) {
+                                BOOST_CHECK_EQUAL(mod.pow_mod(base, exponent), expected);
+                                expected = mod.mul_mod(expected, mod.reduce(base));
+                        }
+                }
+        }
+        auto const prime = xstd::modulus<T>(T{251});
+        for (auto base = T{1}; base != T{251}; ++base) {
+                BOOST_CHECK_EQUAL(prime.pow_mod(base, T{250}), T{1});
+        }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ModulusConstexpr, T, xstd::test::exact_width_unsigned_integer_types)
+{
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::modulus<T>(T{97}).mul_mod(T{50}, T{60})), T{90});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::modulus<T>(T{100}).add_mod(T{50}, T{60})), T{10});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::modulus<T>(T{100}).sub_mod(T{50}, T{60})), T{90});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::modulus<T>(T{101}).pow_mod(T{2}, 10U)), T{14});
+        XSTD_CONSTEXPR_CHECK_EQUAL_IF(xstd::test::has_constexpr_division<T>, (xstd::modulus<T>(T{7}).reduce(T{200})), T{4});
+}
+
+BOOST_AUTO_TEST_SUITE_END()